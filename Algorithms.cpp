@@ -4,29 +4,47 @@ ID: 214539397
 Name: Daniel Kuris
 */
 #include "Algorithms.hpp"
+#include "LandmarkIndex.hpp"
+#include "ShortestPaths.hpp"
+#include "IncrementalConnectivity.hpp"
+#include "BitGraph.hpp"
 #include <queue>
 #include <vector>
 #include <unordered_set>
 #include <climits>
+#include <cmath>
 #include <limits>
 #include <iostream>
 #include <algorithm> 
 #include <sstream>   
+#include <stdexcept>
 
 using namespace std;
 
 namespace ariel {
-     std::string Algorithms::negativeCycle(const Graph& graph) {
+    namespace {
+        // Graphs with at least this many vertices and no negative weights answer shortestPath with ALT
+        const size_t LANDMARK_MIN_VERTICES = 256;
+        // Number of landmarks in the lazily built index
+        const size_t LANDMARK_COUNT = 16;
+        // Graphs with at least this many edges label their components with the parallel Afforest pass
+        const int PARALLEL_COMPONENTS_MIN_EDGES = 1 << 20;
+    }
+
+    template <typename Weight>
+     std::string Algorithms::negativeCycle(const BasicGraph<Weight>& graph) {
+        typedef typename WeightTraits<Weight>::Sum Sum;
+        const Sum unreached = std::numeric_limits<Sum>::max();
         auto V = static_cast<std::vector<std::vector<int>>::size_type>(graph.getNumVertices());
-        std::vector<std::vector<int>> adjMatrix = graph.getGraph(); // Get the adjacency matrix
-        std::vector<int> dist(V, INT_MAX);
+        std::vector<std::vector<Weight>> adjMatrix = graph.getGraph(); // Get the adjacency matrix
+        std::vector<Sum> dist(V, unreached);
         dist[0] = 0;
 
         // Relax edges V - 1 times
         for (std::vector<std::vector<int>>::size_type i = 0; i < V - 1; i++) {
             for (std::vector<std::vector<int>>::size_type u = 0; u < V; u++) {
                 for (std::vector<std::vector<int>>::size_type v = 0; v < V; v++) {
-                    if (graph.isEdge(u, v) && dist[u] != INT_MAX && dist[u] + adjMatrix[u][v] < dist[v]) {
+                    if (graph.isEdge(u, v) && dist[u] != unreached && dist[u] + adjMatrix[u][v] < dist[v]) {
                         dist[v] = dist[u] + adjMatrix[u][v];
                     }
                 }
@@ -36,7 +54,7 @@ namespace ariel {
         // Check for negative cycles
         for (std::vector<std::vector<int>>::size_type u = 0; u < V; u++) {
             for (std::vector<std::vector<int>>::size_type v = 0; v < V; v++) {
-                if (graph.isEdge(u, v) && dist[u] != INT_MAX && dist[u] + adjMatrix[u][v] < dist[v]) {
+                if (graph.isEdge(u, v) && dist[u] != unreached && dist[u] + adjMatrix[u][v] < dist[v]) {
                     return "Negative cycle found"; // Negative cycle found
                 }
             }
@@ -47,6 +65,30 @@ namespace ariel {
 
 
      std::string Algorithms::isBipartite(const Graph& graph) {
+        // An odd cycle seen by the connectivity tracker rules out any 2-coloring
+        std::shared_ptr<IncrementalConnectivity> tracker = graph.connectivityTracker.load();
+        if (tracker && !tracker->isBipartite()) {
+            return "The graph isn't bipartite.";
+        }
+        // Small graphs color whole neighbor sets at once
+        if (static_cast<size_t>(graph.getNumVertices()) <= BitGraph::MAX_VERTICES) {
+            size_t order[BitGraph::MAX_VERTICES];
+            uint64_t sideB = 0;
+            BitGraph bits = BitGraph::fromGraph(graph);
+            if (!bits.bipartition(order, sideB) || sideB == 0) {
+                return "The graph isn't bipartite.";
+            }
+            std::vector<std::vector<int>::size_type> partitionA, partitionB;
+            for (size_t i = 0; i < bits.getNumVertices(); ++i) {
+                (sideB & (uint64_t(1) << order[i]) ? partitionB : partitionA).push_back(order[i]);
+            }
+            return formatBipartition(partitionA, partitionB);
+        }
+        return isBipartite<int>(graph);
+    }
+
+    template <typename Weight>
+     std::string Algorithms::isBipartite(const BasicGraph<Weight>& graph) {
         auto V = static_cast<std::vector<std::vector<int>>::size_type>(graph.getNumVertices());
         std::vector<int> color(V, -1); // Initialize all vertices with no color
         std::queue<std::vector<std::vector<int>>::size_type> q;
@@ -88,7 +130,10 @@ namespace ariel {
         if (partitionA.empty() || partitionB.empty()) {
             return "The graph isn't bipartite."; // Graph is not bipartite due to isolated vertices
         }
+        return formatBipartition(partitionA, partitionB);
+    }
 
+    std::string Algorithms::formatBipartition(const std::vector<std::vector<int>::size_type>& partitionA, const std::vector<std::vector<int>::size_type>& partitionB) {
         // Construct and return the output string
         std::string output = "The graph is bipartite: A={";
         for (size_t i = 0; i < partitionA.size(); ++i) {
@@ -112,6 +157,26 @@ namespace ariel {
 
 
     std::string Algorithms::isContainsCycle(const Graph& graph) {
+        if (static_cast<size_t>(graph.getNumVertices()) > BitGraph::MAX_VERTICES) {
+            return isContainsCycle<int>(graph);
+        }
+        size_t cycle[BitGraph::MAX_VERTICES];
+        size_t length = BitGraph::fromGraph(graph).findCycle(cycle);
+        if (length > 0) {
+            return "The graph contains a cycle: " + formatPath(std::vector<std::vector<int>::size_type>(cycle, cycle + length));
+        }
+        // Without negative weights there can't be a negative cycle
+        if (graph.hasNegativeWeights()) {
+            std::string negativeCycleResult = negativeCycle(graph);
+            if (negativeCycleResult != "No negative cycle found") {
+                return negativeCycleResult;
+            }
+        }
+        return "No cycle found";
+    }
+
+    template <typename Weight>
+    std::string Algorithms::isContainsCycle(const BasicGraph<Weight>& graph) {
         auto V = static_cast<std::vector<std::vector<int>>::size_type>(graph.getNumVertices());
         vector<bool> visited(V, false);
         vector<int> path;
@@ -139,7 +204,8 @@ namespace ariel {
         return "No cycle found"; 
     }
 
-    bool Algorithms::isContainsCycleUtil(const Graph& graph, std::vector<std::vector<int>>::size_type v, vector<bool>& visited, int parent, vector<int>& path, std::vector<std::vector<int>>::size_type start) {
+    template <typename Weight>
+    bool Algorithms::isContainsCycleUtil(const BasicGraph<Weight>& graph, std::vector<std::vector<int>>::size_type v, vector<bool>& visited, int parent, vector<int>& path, std::vector<std::vector<int>>::size_type start) {
         visited[v] = true;
         path.push_back(v);
 
@@ -166,6 +232,10 @@ namespace ariel {
 
 
     std::string Algorithms::shortestPath(const Graph& graph, std::vector<int>::size_type start, std::vector<int>::size_type end) {
+        return shortestPath(graph, start, end, QueueBackend::Auto);
+    }
+
+    std::string Algorithms::shortestPath(const Graph& graph, std::vector<int>::size_type start, std::vector<int>::size_type end, QueueBackend backend) {
         if (start == end) {
             return "Invalid request - path to itself";
         }
@@ -177,8 +247,78 @@ namespace ariel {
 
         auto V = static_cast<std::vector<int>::size_type>(graph.getNumVertices()); // Use auto for V
 
-        std::vector<std::vector<int>> adjMatrix = graph.getGraph();
-        std::vector<int> dist(V, std::numeric_limits<int>::max());
+        // Acyclic graphs relax every edge once in topological order. Negative weights make the
+        // O(V^2) acyclicity check worth it up front; otherwise it's used once the order is known.
+        if (graph.hasNegativeWeights() || (backend == QueueBackend::Auto && graph.topologicalOrder.load())) {
+            const TopologicalOrder& topological = cachedTopologicalOrder(graph);
+            if (topological.acyclic) {
+                std::vector<long long> dist;
+                std::vector<size_t> prev;
+                ShortestPaths::dagShortestPaths(CSRGraph::fromGraph(graph), topological.order, start, dist, prev);
+                if (dist[end] == ShortestPaths::INF) {
+                    return "There is no path between " + std::to_string(start) + " and " + std::to_string(end);
+                }
+                std::vector<std::vector<int>::size_type> pathVertices;
+                for (size_t current = end; current != ShortestPaths::NONE; current = prev[current]) {
+                    pathVertices.push_back(current);
+                }
+                std::reverse(pathVertices.begin(), pathVertices.end());
+                return formatPath(pathVertices);
+            }
+        }
+
+        if (!graph.hasNegativeWeights()) {
+            std::vector<std::vector<int>::size_type> pathVertices;
+            if (backend == QueueBackend::Auto && V <= BitGraph::MAX_VERTICES && graph.numMaxWeightEdges == graph.getNumEdges()) {
+                // Small graphs with a single weight value: the path with the fewest edges, by bitmask BFS
+                size_t path[BitGraph::MAX_VERTICES];
+                size_t length = BitGraph::fromGraph(graph).shortestPath(start, end, path);
+                pathVertices.assign(path, path + length);
+            } else if (backend == QueueBackend::Auto && V >= LANDMARK_MIN_VERTICES) {
+                // Large graphs run A* over the graph's landmark index, built on first use
+                std::shared_ptr<const LandmarkIndex> index = graph.derived(graph.landmarkIndex, [&graph]() {
+                    return std::make_shared<const LandmarkIndex>(graph, LANDMARK_COUNT);
+                });
+                index->query(start, end, pathVertices);
+            } else {
+                // Otherwise Dijkstra, on a bucket queue when the tracked maximum weight is small
+                std::vector<long long> dist;
+                std::vector<size_t> prev;
+                ShortestPaths::dijkstra(CSRGraph::fromGraph(graph), start, end, backend, graph.getMaxWeight(), dist, prev);
+                if (dist[end] != ShortestPaths::INF) {
+                    for (size_t current = end; current != ShortestPaths::NONE; current = prev[current]) {
+                        pathVertices.push_back(current);
+                    }
+                    std::reverse(pathVertices.begin(), pathVertices.end());
+                }
+            }
+            if (pathVertices.empty()) {
+                return "There is no path between " + std::to_string(start) + " and " + std::to_string(end);
+            }
+            return formatPath(pathVertices);
+        }
+
+        // Negative weights on a cyclic graph: Bellman-Ford
+        return shortestPath<int>(graph, start, end);
+    }
+
+    template <typename Weight>
+    std::string Algorithms::shortestPath(const BasicGraph<Weight>& graph, std::vector<int>::size_type start, std::vector<int>::size_type end) {
+        typedef typename WeightTraits<Weight>::Sum Sum;
+        const Sum unreached = std::numeric_limits<Sum>::max();
+        if (start == end) {
+            return "Invalid request - path to itself";
+        }
+
+         // Check if the start and end vertices are within the valid range
+        if (start >= graph.getNumVertices() || end >= graph.getNumVertices()) {
+            return "Invalid start or end vertex";
+        }
+
+        auto V = static_cast<std::vector<int>::size_type>(graph.getNumVertices()); // Use auto for V
+
+        std::vector<std::vector<Weight>> adjMatrix = graph.getGraph();
+        std::vector<Sum> dist(V, unreached);
         std::vector<int> prev(V, -1);
 
         // Initialize distance from start to itself as 0
@@ -188,7 +328,7 @@ namespace ariel {
         for (std::vector<int>::size_type i = 0; i < V - 1; ++i) {
             for (std::vector<int>::size_type u = 0; u < V; ++u) {
                 for (std::vector<int>::size_type v = 0; v < V; ++v) {
-                    if (adjMatrix[u][v] != 0 && dist[u] != std::numeric_limits<int>::max() && dist[u] + adjMatrix[u][v] < dist[v]) {
+                    if (adjMatrix[u][v] != 0 && dist[u] != unreached && dist[u] + adjMatrix[u][v] < dist[v]) {
                         dist[v] = dist[u] + adjMatrix[u][v];
                         prev[v] = u;
                     }
@@ -199,14 +339,14 @@ namespace ariel {
         // Check for negative cycles
         for (std::vector<int>::size_type u = 0; u < V; ++u) {
             for (std::vector<int>::size_type v = 0; v < V; ++v) {
-                if (adjMatrix[u][v] != 0 && dist[u] != std::numeric_limits<int>::max() && dist[u] + adjMatrix[u][v] < dist[v]) {
+                if (adjMatrix[u][v] != 0 && dist[u] != unreached && dist[u] + adjMatrix[u][v] < dist[v]) {
                     return "Negative cycle detected";
                 }
             }
         }
 
         // Reconstruct the shortest path if it exists
-        if (dist[end] == std::numeric_limits<int>::max()) {
+        if (dist[end] == unreached) {
             return "There is no path between " + std::to_string(start) + " and " + std::to_string(end);
         } else {
             std::vector<std::vector<int>::size_type> pathVertices;
@@ -217,17 +357,91 @@ namespace ariel {
             }
             std::reverse(pathVertices.begin(), pathVertices.end());
 
-            // Convert the vertices to a string with arrow separators
-            std::stringstream ss;
-            for (size_t i = 0; i < pathVertices.size(); ++i) {
-                ss << pathVertices[i];
-                if (i < pathVertices.size() - 1) {
-                    ss << "->";
-                }
+            return formatPath(pathVertices);
+        }
+    }
+
+    std::vector<long long> Algorithms::deltaStepping(const Graph& graph, std::vector<int>::size_type start, long long delta, unsigned numThreads) {
+        if (start >= graph.getNumVertices()) {
+            throw std::invalid_argument("Invalid start vertex");
+        }
+        if (graph.hasNegativeWeights()) {
+            throw std::invalid_argument("Invalid graph: Delta-stepping requires non-negative weights.");
+        }
+        return ShortestPaths::deltaStepping(CSRGraph::fromGraph(graph), start, delta, numThreads);
+    }
+
+    SpanningTree Algorithms::minimumSpanningTree(const Graph& graph, MSTMethod method) {
+        if (method == MSTMethod::Auto) {
+            // Prim scans V^2 cells no matter what; Kruskal pays E log E for the sort
+            auto V = static_cast<double>(graph.getNumVertices());
+            auto E = static_cast<double>(graph.getNumEdges());
+            method = E * std::log2(E + 2) < V * V ? MSTMethod::Kruskal : MSTMethod::Prim;
+        }
+        if (method == MSTMethod::Kruskal) {
+            return SpanningTree::kruskal(graph);
+        }
+        return SpanningTree::prim(graph);
+    }
+
+    std::vector<size_t> Algorithms::topologicalOrder(const Graph& graph) {
+        const TopologicalOrder& topological = cachedTopologicalOrder(graph);
+        if (!topological.acyclic) {
+            throw std::invalid_argument("Invalid graph: The graph contains a cycle.");
+        }
+        return topological.order;
+    }
+
+    const TopologicalOrder& Algorithms::cachedTopologicalOrder(const Graph& graph) {
+        return *graph.derived(graph.topologicalOrder, [&graph]() {
+            return std::make_shared<const TopologicalOrder>(TopologicalOrder::fromGraph(graph));
+        });
+    }
+
+    bool Algorithms::isReachable(const Graph& graph, std::vector<int>::size_type u, std::vector<int>::size_type v) {
+        return transitiveClosure(graph).reachable(u, v);
+    }
+
+    const TransitiveClosure& Algorithms::transitiveClosure(const Graph& graph) {
+        return *graph.derived(graph.transitiveClosure, [&graph]() {
+            return std::make_shared<const TransitiveClosure>(graph);
+        });
+    }
+
+    template <typename Semiring>
+    SemiringMatrix<Semiring> Algorithms::graphPower(const Graph& graph, unsigned long long k, const Semiring& ring, bool keepDiagonal) {
+        SemiringMatrix<Semiring> result = ariel::pow(SemiringMatrix<Semiring>::fromGraph(graph, false, ring), k);
+        if (!keepDiagonal) {
+            for (size_t i = 0; i < result.size(); ++i) {
+                result(i, i) = ring.zero();
             }
+        }
+        return result;
+    }
+
+    SemiringMatrix<PlusTimes> Algorithms::pow(const Graph& graph, unsigned long long k, bool keepDiagonal) {
+        return graphPower(graph, k, PlusTimes(), keepDiagonal);
+    }
 
-            return ss.str();
+    SemiringMatrix<ModPlusTimes> Algorithms::powMod(const Graph& graph, unsigned long long k, long long modulus, bool keepDiagonal) {
+        return graphPower(graph, k, ModPlusTimes(modulus), keepDiagonal);
+    }
+
+    MaxFlow Algorithms::maxFlow(const Graph& graph, std::vector<int>::size_type source, std::vector<int>::size_type sink) {
+        return MaxFlow::pushRelabel(graph, source, sink);
+    }
+
+    std::string Algorithms::formatPath(const std::vector<std::vector<int>::size_type>& pathVertices) {
+        // Convert the vertices to a string with arrow separators
+        std::stringstream ss;
+        for (size_t i = 0; i < pathVertices.size(); ++i) {
+            ss << pathVertices[i];
+            if (i < pathVertices.size() - 1) {
+                ss << "->";
+            }
         }
+
+        return ss.str();
     }
 
 
@@ -237,6 +451,97 @@ namespace ariel {
 
 
     bool Algorithms::isConnected(const Graph& graph) {
+        // In an undirected graph "every vertex reachable from 0" is a single component
+        if (graph.isSymmetric()) {
+            std::shared_ptr<IncrementalConnectivity> tracker = graph.connectivityTracker.load();
+            if (tracker) {
+                return tracker->isConnected();
+            }
+            std::shared_ptr<const Components> components = graph.components.load();
+            if (components) {
+                return components->count() == 1;
+            }
+        }
+        // Small graphs run a bitmask BFS
+        if (static_cast<size_t>(graph.getNumVertices()) <= BitGraph::MAX_VERTICES) {
+            return BitGraph::fromGraph(graph).isConnected();
+        }
+        if (graph.isSymmetric()) {
+            return cachedComponents(graph).count() == 1;
+        }
+        return isConnected<int>(graph);
+    }
+
+    namespace {
+        // Compressed graphs must be complete and non-empty before they are searched
+        void checkCompressed(const CompressedGraph& graph) {
+            if (graph.getNumVertices() == 0) {
+                throw std::invalid_argument("Invalid graph: The graph is empty.");
+            }
+            if (!graph.isComplete()) {
+                throw std::invalid_argument("Invalid graph: Some vertices have no neighbor list yet.");
+            }
+        }
+    }
+
+    bool Algorithms::isConnected(const CompressedGraph& graph) {
+        checkCompressed(graph);
+        const size_t V = graph.getNumVertices();
+        std::vector<bool> visited(V, false);
+        std::vector<size_t> frontier(1, 0); // BFS queue, consumed from head
+        visited[0] = true;
+        CompressedGraph::NeighborIterator neighbors(graph);
+        for (size_t head = 0; head < frontier.size(); ++head) {
+            neighbors.reset(frontier[head]);
+            size_t v = 0;
+            while (neighbors.next(v)) {
+                if (!visited[v]) {
+                    visited[v] = true;
+                    frontier.push_back(v);
+                }
+            }
+        }
+        return frontier.size() == V;
+    }
+
+    std::string Algorithms::isBipartite(const CompressedGraph& graph) {
+        checkCompressed(graph);
+        const size_t V = graph.getNumVertices();
+        std::vector<int> color(V, -1);
+        std::vector<size_t> frontier;
+        std::vector<std::vector<int>::size_type> partitionA, partitionB;
+        CompressedGraph::NeighborIterator neighbors(graph);
+        for (size_t i = 0; i < V; ++i) {
+            if (color[i] != -1) {
+                continue;
+            }
+            // Same BFS order and coloring as the matrix version
+            frontier.assign(1, i);
+            color[i] = 1;
+            partitionA.push_back(i);
+            for (size_t head = 0; head < frontier.size(); ++head) {
+                size_t u = frontier[head];
+                neighbors.reset(u);
+                size_t v = 0;
+                while (neighbors.next(v)) {
+                    if (color[v] == -1) {
+                        color[v] = 1 - color[u];
+                        frontier.push_back(v);
+                        (color[v] == 1 ? partitionA : partitionB).push_back(v);
+                    } else if (color[v] == color[u]) {
+                        return "The graph isn't bipartite.";
+                    }
+                }
+            }
+        }
+        if (partitionA.empty() || partitionB.empty()) {
+            return "The graph isn't bipartite.";
+        }
+        return formatBipartition(partitionA, partitionB);
+    }
+
+    template <typename Weight>
+    bool Algorithms::isConnected(const BasicGraph<Weight>& graph) {
         auto V = static_cast<std::vector<std::vector<int>>::size_type>(graph.getNumVertices());
         vector<bool> visited(V, false);
 
@@ -268,4 +573,54 @@ namespace ariel {
         return true; // Graph is connected
     }
 
-}
\ No newline at end of file
+    Components Algorithms::connectedComponents(const Graph& graph) {
+        return cachedComponents(graph);
+    }
+
+    const Components& Algorithms::cachedComponents(const Graph& graph) {
+        return *graph.derived(graph.components, [&graph]() {
+            if (graph.getNumEdges() >= PARALLEL_COMPONENTS_MIN_EDGES) {
+                return std::make_shared<const Components>(Components::parallelFromGraph(graph));
+            }
+            return std::make_shared<const Components>(Components::fromGraph(graph));
+        });
+    }
+
+    StrongComponents Algorithms::stronglyConnectedComponents(const Graph& graph) {
+        return cachedStrongComponents(graph);
+    }
+
+    bool Algorithms::isStronglyConnected(const Graph& graph) {
+        return cachedStrongComponents(graph).count() == 1;
+    }
+
+    bool Algorithms::isWeaklyConnected(const Graph& graph) {
+        std::shared_ptr<IncrementalConnectivity> tracker = graph.connectivityTracker.load();
+        if (tracker) {
+            return tracker->isConnected();
+        }
+        return cachedComponents(graph).count() == 1;
+    }
+
+    const StrongComponents& Algorithms::cachedStrongComponents(const Graph& graph) {
+        return *graph.derived(graph.strongComponents, [&graph]() {
+            return std::make_shared<const StrongComponents>(StrongComponents::fromGraph(graph));
+        });
+    }
+
+
+    // The classic queries for every weight type the library is built for
+    #define ARIEL_INSTANTIATE_ALGORITHMS(Weight) \
+        template std::string Algorithms::negativeCycle(const BasicGraph<Weight>& graph); \
+        template std::string Algorithms::isBipartite(const BasicGraph<Weight>& graph); \
+        template std::string Algorithms::isContainsCycle(const BasicGraph<Weight>& graph); \
+        template std::string Algorithms::shortestPath(const BasicGraph<Weight>& graph, std::vector<int>::size_type start, std::vector<int>::size_type end); \
+        template bool Algorithms::isConnected(const BasicGraph<Weight>& graph);
+    ARIEL_INSTANTIATE_ALGORITHMS(int8_t)
+    ARIEL_INSTANTIATE_ALGORITHMS(int16_t)
+    ARIEL_INSTANTIATE_ALGORITHMS(int32_t)
+    ARIEL_INSTANTIATE_ALGORITHMS(int64_t)
+    ARIEL_INSTANTIATE_ALGORITHMS(float)
+    ARIEL_INSTANTIATE_ALGORITHMS(double)
+    #undef ARIEL_INSTANTIATE_ALGORITHMS
+}
@@ -7,20 +7,109 @@ Name: Daniel Kuris
 #define ALGORITHMS_HPP
 
 #include "Graph.hpp"
+#include "ShortestPaths.hpp"
+#include "Components.hpp"
+#include "SCC.hpp"
+#include "MST.hpp"
+#include "MaxFlow.hpp"
+#include "TopologicalSort.hpp"
+#include "TransitiveClosure.hpp"
+#include "SemiringMatrix.hpp"
+#include "CompressedGraph.hpp"
 #include <string>
 #include <vector>
 
 namespace ariel {
     class Algorithms {
     public:
-        static std::string negativeCycle(const Graph& graph);
+        // The classic queries work on every BasicGraph weight type, with distances summed in
+        // WeightTraits<Weight>::Sum. Graph (int) overloads add the cached and specialised engines.
+        template <typename Weight>
+        static std::string negativeCycle(const BasicGraph<Weight>& graph);
+        template <typename Weight>
+        static std::string isBipartite(const BasicGraph<Weight>& graph);
         static std::string isBipartite(const Graph& graph);
+        template <typename Weight>
+        static std::string isContainsCycle(const BasicGraph<Weight>& graph);
         static std::string isContainsCycle(const Graph& graph);
+        template <typename Weight>
+        static std::string shortestPath(const BasicGraph<Weight>& graph, std::vector<int>::size_type start, std::vector<int>::size_type end);
         static std::string shortestPath(const Graph& graph, std::vector<int>::size_type start, std::vector<int>::size_type end);
+        // Same, with the Dijkstra queue used for graphs without negative weights chosen explicitly
+        static std::string shortestPath(const Graph& graph, std::vector<int>::size_type start, std::vector<int>::size_type end, QueueBackend backend);
+        template <typename Weight>
+        static bool isConnected(const BasicGraph<Weight>& graph);
         static bool isConnected(const Graph& graph);
 
+        // The BFS queries over a compressed adjacency, walked list by list with a NeighborIterator.
+        // Same answers as for the graph it was compressed from.
+        static bool isConnected(const CompressedGraph& graph);
+        static std::string isBipartite(const CompressedGraph& graph);
+
+        // Connected components (edges in either direction), cached on the graph until it changes
+        static Components connectedComponents(const Graph& graph);
+
+        // Strongly connected components and their condensation DAG, cached on the graph until it changes
+        static StrongComponents stronglyConnectedComponents(const Graph& graph);
+
+        // Every vertex reaches every other vertex along directed edges
+        static bool isStronglyConnected(const Graph& graph);
+
+        // The graph is connected when edge directions are ignored
+        static bool isWeaklyConnected(const Graph& graph);
+
+        // Distances from start by parallel delta-stepping (non-negative weights only).
+        // Unreachable vertices get ShortestPaths::INF; delta = 0 picks a width from the weights.
+        static std::vector<long long> deltaStepping(const Graph& graph, std::vector<int>::size_type start, long long delta = 0, unsigned numThreads = 0);
+
+        // Minimum spanning tree (a forest if the graph is disconnected), edge directions ignored.
+        // Auto runs dense Prim unless the graph is sparse enough for Kruskal's E log E to win.
+        static SpanningTree minimumSpanningTree(const Graph& graph, MSTMethod method = MSTMethod::Auto);
+
+        // Vertices ordered so that every edge points forward, cached on the graph until it changes.
+        // Throws if the graph has a directed cycle.
+        static std::vector<size_t> topologicalOrder(const Graph& graph);
+
+        // Check if there is a directed path from u to v. The first call builds the graph's bitset
+        // transitive closure, later calls are O(1) until the graph changes.
+        static bool isReachable(const Graph& graph, std::vector<int>::size_type u, std::vector<int>::size_type v);
+
+        // The graph's cached transitive closure
+        static const TransitiveClosure& transitiveClosure(const Graph& graph);
+
+        // Adjacency matrix to the power k by repeated squaring, in 64-bit arithmetic: entry (i, j) sums
+        // the weight products of the walks of exactly k edges (counts them for unit weights).
+        // keepDiagonal = false zeroes the diagonal of the result, as operator* does.
+        static SemiringMatrix<PlusTimes> pow(const Graph& graph, unsigned long long k, bool keepDiagonal = true);
+
+        // Same modulo modulus, for walk counts that overflow 64 bits
+        static SemiringMatrix<ModPlusTimes> powMod(const Graph& graph, unsigned long long k, long long modulus, bool keepDiagonal = true);
+
+        // Maximum flow from source to sink with weights as capacities, and the matching minimum cut
+        static MaxFlow maxFlow(const Graph& graph, std::vector<int>::size_type source, std::vector<int>::size_type sink);
+
     private:
-       static bool isContainsCycleUtil(const Graph& graph, std::vector<std::vector<int>>::size_type v, std::vector<bool>& visited, int parent, std::vector<int>& path, std::vector<std::vector<int>>::size_type start);
+       // Helper method to get the graph's cached components, labelling them on first use
+       static const Components& cachedComponents(const Graph& graph);
+
+       // Helper method to get the graph's cached strongly connected components
+       static const StrongComponents& cachedStrongComponents(const Graph& graph);
+
+       // Helper method to get the graph's cached topological order
+       static const TopologicalOrder& cachedTopologicalOrder(const Graph& graph);
+
+       // Helper method to raise the graph's adjacency matrix over ring to the power k
+       template <typename Semiring>
+       static SemiringMatrix<Semiring> graphPower(const Graph& graph, unsigned long long k, const Semiring& ring, bool keepDiagonal);
+
+       // Helper method to render the two sides found by isBipartite
+       static std::string formatBipartition(const std::vector<std::vector<int>::size_type>& partitionA, const std::vector<std::vector<int>::size_type>& partitionB);
+
+       // Helper method to render a vertex sequence as "a->b->c"
+       static std::string formatPath(const std::vector<std::vector<int>::size_type>& pathVertices);
+
+       template <typename Weight>
+       static bool isContainsCycleUtil(const BasicGraph<Weight>& graph, std::vector<std::vector<int>>::size_type v, std::vector<bool>& visited, int parent, std::vector<int>& path, std::vector<std::vector<int>>::size_type start);
     };
 }
 
@@ -0,0 +1,633 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "Graph.hpp"
+#include "Algorithms.hpp"
+#include "LandmarkIndex.hpp"
+#include "ShortestPaths.hpp"
+#include "Parallel.hpp"
+#include "Components.hpp"
+#include "MST.hpp"
+#include "MaxFlow.hpp"
+#include "TransitiveClosure.hpp"
+#include "SemiringMatrix.hpp"
+#include "SpGEMM.hpp"
+#include "Strassen.hpp"
+#include "FixedGraph.hpp"
+#include "GraphBatch.hpp"
+#include "GraphParser.hpp"
+#include "CompressedGraph.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+
+namespace {
+    // Seconds elapsed since start
+    double secondsSince(const chrono::steady_clock::time_point& start) {
+        return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    }
+
+    // side x side grid with random weights in [1, maxWeight] on both directions of every edge
+    ariel::Graph gridGraph(size_t side, int maxWeight, unsigned seed) {
+        mt19937 rng(seed);
+        uniform_int_distribution<int> weight(1, maxWeight);
+        size_t V = side * side;
+        vector<vector<int>> matrix(V, vector<int>(V, 0));
+        for (size_t r = 0; r < side; ++r) {
+            for (size_t c = 0; c < side; ++c) {
+                size_t u = r * side + c;
+                if (c + 1 < side) {
+                    matrix[u][u + 1] = matrix[u + 1][u] = weight(rng);
+                }
+                if (r + 1 < side) {
+                    matrix[u][u + side] = matrix[u + side][u] = weight(rng);
+                }
+            }
+        }
+        ariel::Graph graph;
+        graph.loadGraph(matrix);
+        return graph;
+    }
+
+    // Vertices settled per query by plain Dijkstra (0 landmarks) against ALT
+    void benchLandmarks() {
+        cout << "== ALT landmark index ==" << endl;
+        ariel::Graph graph = gridGraph(50, 100, 1);
+        size_t V = static_cast<size_t>(graph.getNumVertices());
+        mt19937 rng(2);
+        uniform_int_distribution<size_t> vertex(0, V - 1);
+        vector<pair<size_t, size_t>> queries;
+        for (int i = 0; i < 200; ++i) {
+            queries.push_back(make_pair(vertex(rng), vertex(rng)));
+        }
+
+        const size_t landmarkCounts[] = {0, 4, 8, 16};
+        for (size_t k : landmarkCounts) {
+            auto start = chrono::steady_clock::now();
+            ariel::LandmarkIndex index(graph, k);
+            double buildTime = secondsSince(start);
+
+            size_t settled = 0;
+            vector<size_t> path;
+            start = chrono::steady_clock::now();
+            for (const auto& query : queries) {
+                settled += index.query(query.first, query.second, path);
+            }
+            double queryTime = secondsSince(start);
+            cout << "landmarks=" << k << " build=" << buildTime << "s"
+                 << " avg settled=" << settled / queries.size()
+                 << " avg query=" << queryTime / static_cast<double>(queries.size()) * 1e6 << "us" << endl;
+        }
+    }
+
+    // One-off single source queries: matrix Bellman-Ford, sequential Dijkstra and delta-stepping
+    void benchDeltaStepping() {
+        cout << "== Delta-stepping SSSP ==" << endl;
+        ariel::Graph small = gridGraph(20, 100, 3);
+        auto start = chrono::steady_clock::now();
+        ariel::Algorithms::negativeCycle(small); // Runs the full V-1 Bellman-Ford rounds from 0
+        cout << "V=" << small.getNumVertices() << " Bellman-Ford (matrix)=" << secondsSince(start) << "s" << endl;
+
+        ariel::Graph graph = gridGraph(60, 100, 3);
+        ariel::CSRGraph csr = ariel::CSRGraph::fromGraph(graph);
+        start = chrono::steady_clock::now();
+        vector<long long> expected = ariel::ShortestPaths::dijkstra(csr, 0);
+        cout << "V=" << graph.getNumVertices() << " Dijkstra=" << secondsSince(start) << "s" << endl;
+
+        long long deltas[] = {10, 50, ariel::ShortestPaths::defaultDelta(csr), 200};
+        for (long long delta : deltas) {
+            for (unsigned threads = 1; threads <= ariel::defaultThreadCount(); threads *= 2) {
+                start = chrono::steady_clock::now();
+                vector<long long> dist = ariel::ShortestPaths::deltaStepping(csr, 0, delta, threads);
+                double elapsed = secondsSince(start);
+                cout << "V=" << graph.getNumVertices() << " delta-stepping delta=" << delta << " threads=" << threads
+                     << " " << elapsed << "s" << (dist == expected ? "" : " MISMATCH") << endl;
+            }
+        }
+    }
+
+    // Dijkstra queue backends on small integer weights (1 to 100) and on wide weights
+    void benchQueueBackends() {
+        cout << "== Dijkstra queue backends ==" << endl;
+        const int maxWeights[] = {100, 1000000};
+        const ariel::QueueBackend backends[] = {ariel::QueueBackend::BinaryHeap, ariel::QueueBackend::Dial, ariel::QueueBackend::RadixHeap};
+        const char* names[] = {"binary heap", "dial", "radix heap"};
+        for (int maxWeight : maxWeights) {
+            ariel::Graph graph = gridGraph(60, maxWeight, 4);
+            ariel::CSRGraph csr = ariel::CSRGraph::fromGraph(graph);
+            vector<long long> dist;
+            vector<size_t> prev;
+            for (size_t b = 0; b < 3; ++b) {
+                if (backends[b] == ariel::QueueBackend::Dial && maxWeight > ariel::ShortestPaths::DIAL_MAX_WEIGHT) {
+                    continue; // Auto never picks Dial for weights this wide
+                }
+                auto start = chrono::steady_clock::now();
+                for (size_t source = 0; source < 20; ++source) {
+                    ariel::ShortestPaths::dijkstra(csr, source * 97, ariel::ShortestPaths::NONE, backends[b], graph.getMaxWeight(), dist, prev);
+                }
+                cout << "maxWeight=" << maxWeight << " " << names[b] << " " << secondsSince(start) / 20 * 1e3 << "ms per search" << endl;
+            }
+        }
+    }
+
+    // Sequential union-find against Afforest on 1 to N threads, on a graph with millions of edges
+    void benchComponents() {
+        cout << "== Connected components ==" << endl;
+        size_t V = 3000;
+        mt19937 rng(5);
+        bernoulli_distribution edge(0.15);
+        vector<vector<int>> matrix(V, vector<int>(V, 0));
+        for (size_t u = 0; u < V; ++u) {
+            for (size_t v = u + 1; v < V; ++v) {
+                if (edge(rng)) {
+                    matrix[u][v] = matrix[v][u] = 1;
+                }
+            }
+        }
+        ariel::Graph graph;
+        graph.loadGraph(matrix);
+
+        auto start = chrono::steady_clock::now();
+        ariel::Components expected = ariel::Components::fromGraph(graph);
+        cout << "E=" << graph.getNumEdges() << " union-find=" << secondsSince(start) << "s" << endl;
+        unsigned maxThreads = max(4u, ariel::defaultThreadCount());
+        for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+            start = chrono::steady_clock::now();
+            ariel::Components components = ariel::Components::parallelFromGraph(graph, threads);
+            cout << "E=" << graph.getNumEdges() << " afforest threads=" << threads << " " << secondsSince(start) << "s"
+                 << (components.id == expected.id ? "" : " MISMATCH") << endl;
+        }
+    }
+
+    // Dense Prim against parallel Kruskal on a sparse and a dense random graph
+    void benchSpanningTree() {
+        cout << "== Minimum spanning tree ==" << endl;
+        const double densities[] = {0.005, 0.5};
+        for (double density : densities) {
+            size_t V = 2000;
+            mt19937 rng(6);
+            bernoulli_distribution edge(density);
+            uniform_int_distribution<int> weight(1, 1000);
+            vector<vector<int>> matrix(V, vector<int>(V, 0));
+            for (size_t u = 0; u < V; ++u) {
+                for (size_t v = u + 1; v < V; ++v) {
+                    if (edge(rng)) {
+                        matrix[u][v] = matrix[v][u] = weight(rng);
+                    }
+                }
+            }
+            ariel::Graph graph;
+            graph.loadGraph(matrix);
+
+            auto start = chrono::steady_clock::now();
+            long long expected = ariel::SpanningTree::prim(graph).totalWeight;
+            cout << "E=" << graph.getNumEdges() << " prim=" << secondsSince(start) << "s" << endl;
+            unsigned maxThreads = max(4u, ariel::defaultThreadCount());
+            for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+                start = chrono::steady_clock::now();
+                long long total = ariel::SpanningTree::kruskal(graph, threads).totalWeight;
+                cout << "E=" << graph.getNumEdges() << " kruskal threads=" << threads << " " << secondsSince(start) << "s"
+                     << (total == expected ? "" : " MISMATCH") << endl;
+            }
+        }
+    }
+
+    // Corner to corner flow on a grid and on a dense random graph
+    void benchMaxFlow() {
+        cout << "== Push-relabel maximum flow ==" << endl;
+        ariel::Graph grid = gridGraph(70, 100, 7);
+        size_t V = static_cast<size_t>(grid.getNumVertices());
+        auto start = chrono::steady_clock::now();
+        long long value = ariel::MaxFlow::pushRelabel(grid, 0, V - 1).value;
+        cout << "grid V=" << V << " flow=" << value << " " << secondsSince(start) << "s" << endl;
+
+        V = 2000;
+        mt19937 rng(8);
+        bernoulli_distribution edge(0.1);
+        uniform_int_distribution<int> capacity(1, 1000);
+        vector<vector<int>> matrix(V, vector<int>(V, 0));
+        for (size_t u = 0; u < V; ++u) {
+            for (size_t v = 0; v < V; ++v) {
+                if (u != v && edge(rng)) {
+                    matrix[u][v] = capacity(rng);
+                }
+            }
+        }
+        ariel::Graph dense;
+        dense.loadGraph(matrix);
+        start = chrono::steady_clock::now();
+        value = ariel::MaxFlow::pushRelabel(dense, 0, V - 1).value;
+        cout << "random V=" << V << " E=" << dense.getNumEdges() << " flow=" << value << " " << secondsSince(start) << "s" << endl;
+    }
+
+    // Build time and memory of both closure methods, then query throughput
+    void benchTransitiveClosure() {
+        cout << "== Transitive closure ==" << endl;
+        size_t V = 2000;
+        mt19937 rng(9);
+        bernoulli_distribution edge(0.001);
+        vector<vector<int>> matrix(V, vector<int>(V, 0));
+        for (size_t u = 0; u < V; ++u) {
+            for (size_t v = 0; v < V; ++v) {
+                if (u != v && edge(rng)) {
+                    matrix[u][v] = 1;
+                }
+            }
+        }
+        ariel::Graph graph;
+        graph.loadGraph(matrix);
+
+        const ariel::ClosureMethod methods[] = {ariel::ClosureMethod::Condensation, ariel::ClosureMethod::Warshall};
+        const char* names[] = {"condensation", "warshall"};
+        for (size_t m = 0; m < 2; ++m) {
+            auto start = chrono::steady_clock::now();
+            ariel::TransitiveClosure closure(graph, methods[m]);
+            double buildSeconds = secondsSince(start);
+
+            uniform_int_distribution<size_t> vertex(0, V - 1);
+            size_t queries = 5000000;
+            size_t hits = 0;
+            start = chrono::steady_clock::now();
+            for (size_t i = 0; i < queries; ++i) {
+                hits += closure.reachable(vertex(rng), vertex(rng)) ? 1u : 0u;
+            }
+            double querySeconds = secondsSince(start);
+            cout << names[m] << " E=" << graph.getNumEdges() << " rows=" << closure.getNumRows()
+                 << " build=" << buildSeconds << "s memory=" << closure.memoryBytes() / 1024 << "KiB "
+                 << queries / querySeconds / 1e6 << "M queries/s (hits=" << hits << ")" << endl;
+        }
+    }
+
+    // Dense random graph with weights in [1, maxWeight], density given as a probability
+    ariel::Graph randomGraph(size_t V, double density, int maxWeight, unsigned seed) {
+        mt19937 rng(seed);
+        bernoulli_distribution edge(density);
+        uniform_int_distribution<int> weight(1, maxWeight);
+        vector<vector<int>> matrix(V, vector<int>(V, 0));
+        for (size_t u = 0; u < V; ++u) {
+            for (size_t v = 0; v < V; ++v) {
+                if (u != v && edge(rng)) {
+                    matrix[u][v] = weight(rng);
+                }
+            }
+        }
+        ariel::Graph graph;
+        graph.loadGraph(matrix);
+        return graph;
+    }
+
+    template <typename Semiring>
+    void benchSemiring(const char* name, const ariel::Graph& graph, unsigned numThreads) {
+        ariel::SemiringMatrix<Semiring> matrix = ariel::SemiringMatrix<Semiring>::fromGraph(graph, true);
+        auto start = chrono::steady_clock::now();
+        matrix.multiply(matrix, numThreads);
+        cout << name << " V=" << matrix.size() << " threads=" << numThreads << " " << secondsSince(start) << "s" << endl;
+    }
+
+    // One kernel, four semirings, and the thread scaling of operator*
+    void benchMatrixProduct() {
+        cout << "== Semiring matrix product ==" << endl;
+        ariel::Graph graph = randomGraph(600, 0.5, 100, 10);
+        benchSemiring<ariel::PlusTimes>("plus-times", graph, 1);
+        benchSemiring<ariel::MinPlus>("min-plus", graph, 1);
+        benchSemiring<ariel::OrAnd>("or-and", graph, 1);
+        benchSemiring<ariel::MaxMin>("max-min", graph, 1);
+        unsigned maxThreads = max(4u, ariel::defaultThreadCount());
+        for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+            benchSemiring<ariel::PlusTimes>("plus-times", graph, threads);
+        }
+        auto start = chrono::steady_clock::now();
+        ariel::Graph product = graph * graph;
+        cout << "operator* V=600 " << secondsSince(start) << "s" << endl;
+    }
+
+    // A^1000 by squaring against the 999 products of a plain loop (timed on the first 50)
+    void benchGraphPower() {
+        cout << "== Graph power ==" << endl;
+        ariel::Graph graph = randomGraph(300, 0.1, 1, 11);
+        auto start = chrono::steady_clock::now();
+        ariel::SemiringMatrix<ariel::ModPlusTimes> squared = ariel::Algorithms::powMod(graph, 1000, 1000000007);
+        cout << "squaring A^1000 " << secondsSince(start) << "s" << endl;
+
+        ariel::SemiringMatrix<ariel::ModPlusTimes> base = ariel::SemiringMatrix<ariel::ModPlusTimes>::fromGraph(graph);
+        ariel::SemiringMatrix<ariel::ModPlusTimes> walked = base;
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < 50; ++i) {
+            walked = walked * base;
+        }
+        cout << "repeated products, extrapolated to 999: " << secondsSince(start) / 50 * 999 << "s"
+             << " (walks from 0: " << squared(0, 0) << ")" << endl;
+    }
+
+    // Gustavson against the dense kernel at 0.1% density
+    void benchSparseProduct() {
+        cout << "== Sparse matrix product ==" << endl;
+        ariel::Graph graph = randomGraph(2000, 0.001, 10, 12);
+        ariel::CSRGraph csr = ariel::CSRGraph::fromGraph(graph);
+        auto start = chrono::steady_clock::now();
+        ariel::SemiringMatrix<ariel::PlusTimes> matrix = ariel::SemiringMatrix<ariel::PlusTimes>::fromGraph(graph);
+        matrix.multiply(matrix, 1);
+        cout << "dense kernel V=2000 E=" << graph.getNumEdges() << " " << secondsSince(start) << "s" << endl;
+        unsigned maxThreads = max(4u, ariel::defaultThreadCount());
+        for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+            start = chrono::steady_clock::now();
+            ariel::SparseProduct product = ariel::SparseProduct::multiply(csr, csr, threads);
+            cout << "gustavson threads=" << threads << " nnz=" << product.numNonZeros() << " " << secondsSince(start) << "s" << endl;
+        }
+        start = chrono::steady_clock::now();
+        ariel::Graph squared = graph * graph;
+        cout << "operator* " << secondsSince(start) << "s" << endl;
+    }
+
+    // Blocked kernel against Strassen-Winograd at several leaf sizes, to find the crossover
+    void benchStrassen() {
+        cout << "== Strassen-Winograd crossover ==" << endl;
+        const size_t sizes[] = {256, 512, 1024, 2048};
+        const size_t cutoffs[] = {64, 128, 256, 512};
+        for (size_t n : sizes) {
+            mt19937 rng(13);
+            uniform_int_distribution<int> weight(-100, 100);
+            vector<long long> a(n * n), b(n * n), c(n * n, 0), s(n * n);
+            for (size_t i = 0; i < n * n; ++i) {
+                a[i] = weight(rng);
+                b[i] = weight(rng);
+            }
+            auto start = chrono::steady_clock::now();
+            ariel::semiringMultiply(ariel::PlusTimes(), n, a.data(), b.data(), c.data(), 1);
+            cout << "n=" << n << " blocked=" << secondsSince(start) << "s";
+            for (size_t cutoff : cutoffs) {
+                if (cutoff >= n) {
+                    continue;
+                }
+                start = chrono::steady_clock::now();
+                ariel::Strassen::multiply(n, a.data(), b.data(), s.data(), cutoff, 1);
+                cout << " strassen/" << cutoff << "=" << secondsSince(start) << "s" << (s == c ? "" : " MISMATCH");
+            }
+            cout << endl;
+        }
+    }
+    void benchFixedGraph() {
+        cout << "== Fixed-size graphs (8 vertices, 100000 graphs) ==" << endl;
+        const size_t count = 100000;
+        mt19937 rng(43);
+        vector<ariel::FixedGraph<8>> fixed(count);
+        vector<ariel::Graph> dynamic(count);
+        for (size_t g = 0; g < count; ++g) {
+            for (size_t i = 0; i < 8; ++i) {
+                for (size_t j = i + 1; j < 8; ++j) {
+                    if (rng() % 3 == 0) {
+                        int weight = static_cast<int>(rng() % 9) + 1;
+                        fixed[g].setWeight(i, j, weight);
+                        fixed[g].setWeight(j, i, weight);
+                    }
+                }
+            }
+            dynamic[g].loadGraph(fixed[g].toMatrix());
+        }
+
+        size_t pathChars = 0;
+        auto start = chrono::steady_clock::now();
+        size_t fixedBipartite = 0;
+        long long fixedDistance = 0;
+        for (const ariel::FixedGraph<8>& graph : fixed) {
+            fixedBipartite += ariel::FixedAlgorithms::isBipartite(graph) ? 1u : 0u;
+            fixedDistance += ariel::FixedAlgorithms::shortestPath(graph, 0, 7).distance;
+        }
+        double fixedTime = secondsSince(start);
+
+        start = chrono::steady_clock::now();
+        size_t dynamicBipartite = 0;
+        for (const ariel::Graph& graph : dynamic) {
+            dynamicBipartite += ariel::Algorithms::isBipartite<int>(graph) != "The graph isn't bipartite." ? 1u : 0u;
+            pathChars += ariel::Algorithms::shortestPath<int>(graph, 0, 7).size();
+        }
+        double dynamicTime = secondsSince(start);
+        cout << "FixedGraph<8>: " << fixedTime << "s, Graph: " << dynamicTime << "s"
+             << (fixedBipartite == dynamicBipartite ? "" : " MISMATCH") << " (checksum " << fixedDistance + static_cast<long long>(pathChars) << ")" << endl;
+    }
+    void benchBitGraph() {
+        cout << "== Bitmask engine (64 vertices, 2000 graphs) ==" << endl;
+        vector<ariel::Graph> graphs;
+        for (unsigned seed = 0; seed < 2000; ++seed) {
+            graphs.push_back(randomGraph(64, 0.05, 1, seed));
+        }
+        auto start = chrono::steady_clock::now();
+        size_t bitmask = 0;
+        for (const ariel::Graph& graph : graphs) {
+            bitmask += ariel::Algorithms::isContainsCycle(graph).size();
+            ariel::Algorithms::shortestPath(graph, 0, 63);
+        }
+        double bitmaskTime = secondsSince(start);
+        start = chrono::steady_clock::now();
+        size_t generic = 0;
+        for (const ariel::Graph& graph : graphs) {
+            generic += ariel::Algorithms::isContainsCycle<int>(graph).size();
+            ariel::Algorithms::shortestPath<int>(graph, 0, 63);
+        }
+        double genericTime = secondsSince(start);
+        cout << "cycle + path: bitmask=" << bitmaskTime << "s generic=" << genericTime << "s"
+             << (bitmask == generic ? "" : " MISMATCH") << endl;
+    }
+    void benchGraphBatch() {
+        cout << "== Graph batch (8 vertices, 100000 graphs) ==" << endl;
+        const size_t count = 100000;
+        mt19937 rng(45);
+        ariel::GraphBatch batch(8, count);
+        for (size_t g = 0; g < count; ++g) {
+            for (size_t i = 0; i < 8; ++i) {
+                for (size_t j = i + 1; j < 8; ++j) {
+                    if (rng() % 4 == 0) {
+                        int weight = static_cast<int>(rng() % 9) - 1;
+                        batch.setWeight(g, i, j, weight);
+                        batch.setWeight(g, j, i, weight);
+                    }
+                }
+            }
+        }
+        vector<ariel::Graph> graphs;
+        graphs.reserve(count);
+        for (size_t g = 0; g < count; ++g) {
+            graphs.push_back(batch.getGraph(g));
+        }
+
+        auto start = chrono::steady_clock::now();
+        size_t single = 0;
+        for (const ariel::Graph& graph : graphs) {
+            single += ariel::Algorithms::isConnected<int>(graph) ? 1u : 0u;
+            single += ariel::Algorithms::isBipartite<int>(graph) != "The graph isn't bipartite." ? 1u : 0u;
+            single += ariel::Algorithms::negativeCycle(graph) == "Negative cycle found" ? 1u : 0u;
+        }
+        cout << "one graph at a time: " << secondsSince(start) << "s" << endl;
+
+        const unsigned threadCounts[] = {1, 0};
+        for (unsigned threads : threadCounts) {
+            start = chrono::steady_clock::now();
+            vector<unsigned char> connected = batch.isConnected(threads);
+            vector<unsigned char> bipartite = batch.isBipartite(threads);
+            vector<unsigned char> negative = batch.negativeCycle(threads);
+            double elapsed = secondsSince(start);
+            size_t batched = 0;
+            for (size_t g = 0; g < count; ++g) {
+                batched += static_cast<size_t>(connected[g] + bipartite[g] + negative[g]);
+            }
+            cout << "batched, " << (threads == 0 ? ariel::defaultThreadCount() : threads) << " thread(s): " << elapsed << "s"
+                 << (batched == single ? "" : " MISMATCH") << endl;
+        }
+    }
+    void benchGraphFile() {
+        cout << "== Mapped graph file (3000 vertices) ==" << endl;
+        ariel::Graph graph = randomGraph(3000, 0.002, 100, 47);
+        vector<vector<int>> matrix = graph.getGraph();
+        graph.saveGraphFile("/tmp/ariel_bench.graph", ariel::GraphFileLayout::CSR);
+        auto start = chrono::steady_clock::now();
+        ariel::Graph loaded;
+        loaded.loadGraph(matrix);
+        double loadTime = secondsSince(start);
+        start = chrono::steady_clock::now();
+        ariel::Graph mapped;
+        mapped.loadGraphFile("/tmp/ariel_bench.graph");
+        double mapTime = secondsSince(start);
+        bool same = ariel::CSRGraph::fromGraph(mapped).targets == ariel::CSRGraph::fromGraph(loaded).targets;
+        cout << "startup: loadGraph=" << loadTime << "s loadGraphFile=" << mapTime << "s"
+             << (same ? "" : " MISMATCH") << endl;
+        remove("/tmp/ariel_bench.graph");
+    }
+    void benchGraphParser() {
+        cout << "== Text parsers (3000 vertices, 2M edge lines) ==" << endl;
+        {
+            mt19937 rng(48);
+            uniform_int_distribution<int> vertex(0, 2999);
+            uniform_int_distribution<int> weight(1, 1000);
+            ofstream out("/tmp/ariel_bench.txt");
+            for (int i = 0; i < 2000000; ++i) {
+                int u = vertex(rng);
+                int v = vertex(rng);
+                if (u != v) {
+                    out << u << ' ' << v << ' ' << weight(rng) << '\n';
+                }
+            }
+        }
+        ariel::Graph graph;
+        ariel::ParseReport single = ariel::GraphParser::load(graph, "/tmp/ariel_bench.txt", ariel::GraphTextFormat::EdgeList, 1);
+        ariel::ParseReport parallel = ariel::GraphParser::load(graph, "/tmp/ariel_bench.txt", ariel::GraphTextFormat::EdgeList);
+        cout << "edge list: 1 thread=" << single.megabytesPerSecond() << "MB/s all threads="
+             << parallel.megabytesPerSecond() << "MB/s (" << parallel.bytes / 1000000 << "MB)" << endl;
+        remove("/tmp/ariel_bench.txt");
+    }
+    void benchSnapshot() {
+        cout << "== Snapshot save/restore (3000 vertices, 0.2% dense) ==" << endl;
+        ariel::Graph graph = randomGraph(3000, 0.002, 100, 49);
+        auto start = chrono::steady_clock::now();
+        stringstream stream;
+        graph.saveSnapshot(stream);
+        double saveTime = secondsSince(start);
+        start = chrono::steady_clock::now();
+        ariel::Graph restored;
+        restored.restoreSnapshot(stream);
+        double restoreTime = secondsSince(start);
+        start = chrono::steady_clock::now();
+        ariel::Graph reloaded;
+        reloaded.loadGraph(graph.getGraph());
+        double reloadTime = secondsSince(start);
+        cout << "snapshot: " << stream.str().size() / 1000 << "KB (matrix " << 3000 * 3000 * sizeof(int) / 1000
+             << "KB) save=" << saveTime << "s restore=" << restoreTime << "s getGraph+loadGraph=" << reloadTime << "s"
+             << (restored == graph ? "" : " MISMATCH") << endl;
+    }
+    void benchCompressedGraph() {
+        cout << "== Compressed adjacency (200000 vertices, web-like lists) ==" << endl;
+        // Each list keeps most of the previous one and adds a few local and far links
+        const size_t V = 200000;
+        mt19937 rng(50);
+        uniform_int_distribution<int> coin(0, 99);
+        uniform_int_distribution<size_t> anyVertex(0, V - 1);
+        uniform_int_distribution<size_t> nearby(0, 200);
+        ariel::CSRGraph csr;
+        csr.numVertices = V;
+        csr.offsets.assign(1, 0);
+        vector<size_t> previous;
+        vector<size_t> row;
+        for (size_t u = 0; u < V; ++u) {
+            row.clear();
+            for (size_t v : previous) {
+                if (coin(rng) < 80 && v != u) {
+                    row.push_back(v);
+                }
+            }
+            for (int k = 0; k < 3; ++k) {
+                size_t local = min(V - 1, u + nearby(rng));
+                size_t far = anyVertex(rng);
+                if (local != u) {
+                    row.push_back(local);
+                }
+                if (far != u && coin(rng) < 30) {
+                    row.push_back(far);
+                }
+            }
+            sort(row.begin(), row.end());
+            row.erase(unique(row.begin(), row.end()), row.end());
+            csr.targets.insert(csr.targets.end(), row.begin(), row.end());
+            csr.offsets.push_back(csr.targets.size());
+            previous = row;
+        }
+        csr.weights.assign(csr.targets.size(), 1);
+        auto start = chrono::steady_clock::now();
+        ariel::CompressedGraph plain = ariel::CompressedGraph::fromCSR(csr, 0);
+        ariel::CompressedGraph referenced = ariel::CompressedGraph::fromCSR(csr);
+        double buildTime = secondsSince(start);
+        double csrBits = (32.0 * static_cast<double>(csr.numEdges()) + 64.0 * static_cast<double>(V + 1)) / static_cast<double>(csr.numEdges());
+
+        // BFS over the compressed lists and over the CSR arrays
+        start = chrono::steady_clock::now();
+        bool connected = ariel::Algorithms::isConnected(referenced);
+        double compressedTime = secondsSince(start);
+        start = chrono::steady_clock::now();
+        vector<bool> visited(V, false);
+        vector<size_t> frontier(1, 0);
+        visited[0] = true;
+        for (size_t head = 0; head < frontier.size(); ++head) {
+            size_t u = frontier[head];
+            for (size_t e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e) {
+                if (!visited[csr.targets[e]]) {
+                    visited[csr.targets[e]] = true;
+                    frontier.push_back(csr.targets[e]);
+                }
+            }
+        }
+        double csrTime = secondsSince(start);
+        cout << csr.numEdges() << " edges, bits/edge: csr32=" << csrBits << " gaps=" << plain.bitsPerEdge()
+             << " gaps+references=" << referenced.bitsPerEdge() << " (build " << buildTime << "s)" << endl;
+        cout << "BFS: compressed=" << compressedTime << "s csr=" << csrTime << "s"
+             << (connected == (frontier.size() == V) ? "" : " MISMATCH") << endl;
+    }
+}
+
+int main() {
+    benchLandmarks();
+    benchDeltaStepping();
+    benchQueueBackends();
+    benchComponents();
+    benchSpanningTree();
+    benchMaxFlow();
+    benchTransitiveClosure();
+    benchMatrixProduct();
+    benchGraphPower();
+    benchSparseProduct();
+    benchStrassen();
+    benchFixedGraph();
+    benchBitGraph();
+    benchGraphBatch();
+    benchGraphFile();
+    benchGraphParser();
+    benchSnapshot();
+    benchCompressedGraph();
+    return 0;
+}
@@ -0,0 +1,197 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "BitGraph.hpp"
+#include <stdexcept>
+
+namespace ariel {
+
+    namespace {
+        // Index of the lowest set bit, mask must be non-zero
+        inline size_t lowestBit(uint64_t mask) {
+            return static_cast<size_t>(__builtin_ctzll(mask));
+        }
+
+        inline uint64_t bit(size_t v) {
+            return uint64_t(1) << v;
+        }
+    }
+
+    const size_t BitGraph::MAX_VERTICES;
+
+    BitGraph BitGraph::fromGraph(const Graph& graph) {
+        const auto V = static_cast<size_t>(graph.getNumVertices());
+        if (V > MAX_VERTICES) {
+            throw std::invalid_argument("Invalid graph: Too many vertices for a bitmask graph.");
+        }
+        BitGraph result;
+        result.numVertices = V;
+        for (size_t v = 0; v < MAX_VERTICES; ++v) {
+            result.out[v] = 0;
+            result.in[v] = 0;
+        }
+        for (size_t u = 0; u < V; ++u) {
+            for (size_t v = 0; v < V; ++v) {
+                if (graph.isEdge(u, v)) {
+                    result.out[u] |= bit(v);
+                    result.in[v] |= bit(u);
+                }
+            }
+        }
+        return result;
+    }
+
+    size_t BitGraph::getNumVertices() const {
+        return numVertices;
+    }
+
+    uint64_t BitGraph::allVertices() const {
+        return numVertices == MAX_VERTICES ? ~uint64_t(0) : bit(numVertices) - 1;
+    }
+
+    bool BitGraph::isConnected() const {
+        if (numVertices == 0) {
+            return true;
+        }
+        // Level-synchronous BFS: the next frontier is the union of the frontier's rows
+        uint64_t visited = 1;
+        uint64_t frontier = 1;
+        while (frontier != 0) {
+            uint64_t next = 0;
+            for (uint64_t rest = frontier; rest != 0; rest &= rest - 1) {
+                next |= out[lowestBit(rest)];
+            }
+            frontier = next & ~visited;
+            visited |= frontier;
+        }
+        return visited == allVertices();
+    }
+
+    bool BitGraph::bipartition(size_t (&order)[MAX_VERTICES], uint64_t& sideB) const {
+        uint64_t colored = 0;
+        sideB = 0;
+        size_t tail = 0;
+        size_t head = 0;
+        for (size_t i = 0; i < numVertices; ++i) {
+            if (colored & bit(i)) {
+                continue;
+            }
+            order[tail++] = i;
+            colored |= bit(i);
+            while (head < tail) {
+                size_t u = order[head++];
+                bool uInB = (sideB & bit(u)) != 0;
+                uint64_t sameSide = uInB ? sideB : colored & ~sideB;
+                if (out[u] & sameSide) {
+                    return false;
+                }
+                // New neighbors are queued in increasing order, like the scan over the row
+                uint64_t fresh = out[u] & ~colored;
+                colored |= fresh;
+                if (!uInB) {
+                    sideB |= fresh;
+                }
+                for (; fresh != 0; fresh &= fresh - 1) {
+                    order[tail++] = lowestBit(fresh);
+                }
+            }
+        }
+        return true;
+    }
+
+    size_t BitGraph::findCycle(size_t (&path)[MAX_VERTICES]) const {
+        size_t parent[MAX_VERTICES];
+        size_t next[MAX_VERTICES]; // First neighbor of the frame not examined yet
+        uint64_t visited = 0;
+        for (size_t root = 0; root < numVertices; ++root) {
+            if (visited & bit(root)) {
+                continue;
+            }
+            size_t depth = 1;
+            path[0] = root;
+            parent[0] = MAX_VERTICES; // No parent
+            next[0] = 0;
+            visited |= bit(root);
+            while (depth > 0) {
+                size_t top = depth - 1;
+                size_t v = path[top];
+                uint64_t remaining = next[top] < MAX_VERTICES ? out[v] & ~(bit(next[top]) - 1) : 0;
+                uint64_t unvisited = remaining & ~visited;
+                size_t child = unvisited != 0 ? lowestBit(unvisited) : MAX_VERTICES;
+                // Visited neighbors scanned before the next child: only the root closes a cycle
+                if ((remaining & bit(root)) && root < child && root != parent[top]) {
+                    return depth;
+                }
+                if (child == MAX_VERTICES) {
+                    depth--;
+                    continue;
+                }
+                next[top] = child + 1;
+                visited |= bit(child);
+                path[depth] = child;
+                parent[depth] = v;
+                next[depth] = 0;
+                depth++;
+            }
+        }
+        return 0;
+    }
+
+    size_t BitGraph::shortestPath(size_t start, size_t end, size_t (&path)[MAX_VERTICES]) const {
+        if (start >= numVertices || end >= numVertices) {
+            throw std::invalid_argument("Invalid start or end vertex");
+        }
+        uint64_t levels[MAX_VERTICES];
+        size_t numLevels = 1;
+        levels[0] = bit(start);
+        uint64_t visited = bit(start);
+        while (!(visited & bit(end))) {
+            uint64_t next = 0;
+            for (uint64_t rest = levels[numLevels - 1]; rest != 0; rest &= rest - 1) {
+                next |= out[lowestBit(rest)];
+            }
+            next &= ~visited;
+            if (next == 0) {
+                return 0;
+            }
+            visited |= next;
+            levels[numLevels++] = next;
+        }
+
+        // Each vertex keeps the predecessor Algorithms' Bellman-Ford keeps: the first one its
+        // u = 0..V-1 sweeps relax from with a final distance. sweep[v] numbers that sweep for v, so
+        // the pick is the predecessor one level up with the smallest (sweep, id). The last level
+        // only needs end.
+        size_t prev[MAX_VERTICES];
+        size_t sweep[MAX_VERTICES];
+        sweep[start] = 0;
+        for (size_t level = 1; level < numLevels; ++level) {
+            for (uint64_t rest = level + 1 < numLevels ? levels[level] : bit(end); rest != 0; rest &= rest - 1) {
+                size_t v = lowestBit(rest);
+                uint64_t predecessors = in[v] & levels[level - 1];
+                size_t best = lowestBit(predecessors);
+                for (predecessors &= predecessors - 1; predecessors != 0; predecessors &= predecessors - 1) {
+                    size_t u = lowestBit(predecessors);
+                    if (sweep[u] < sweep[best]) {
+                        best = u; // Ids ascend, so equal sweeps keep the smaller id
+                    }
+                }
+                prev[v] = best;
+                sweep[v] = best < v ? sweep[best] : sweep[best] + 1;
+            }
+        }
+
+        // Walk back from end
+        size_t current = end;
+        for (size_t level = numLevels; level-- > 0;) {
+            path[level] = current;
+            if (level > 0) {
+                current = prev[current];
+            }
+        }
+        return numLevels;
+    }
+
+} // namespace ariel
@@ -0,0 +1,54 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef BITGRAPH_HPP
+#define BITGRAPH_HPP
+
+#include "Graph.hpp"
+#include <cstdint>
+
+namespace ariel {
+
+    // Graph of at most 64 vertices with every adjacency row (and column) packed in one uint64_t.
+    // Searches advance whole neighbor sets with a few AND/OR/ctz operations per vertex and keep all
+    // their state in fixed-size arrays, so nothing is allocated. The visiting orders and tie-breaks
+    // are those of Algorithms' searches, so the answers (and the strings built from them) match.
+    class BitGraph {
+    public:
+        static const size_t MAX_VERTICES = 64;
+
+        // Pack graph's edges, throws if it has more than MAX_VERTICES vertices
+        static BitGraph fromGraph(const Graph& graph);
+
+        size_t getNumVertices() const;
+
+        // Every vertex is reachable from vertex 0
+        bool isConnected() const;
+
+        // BFS 2-coloring in the order of Algorithms::isBipartite. Returns false on a conflict; otherwise
+        // order holds every vertex in coloring order and sideB the mask of the vertices of the second color
+        bool bipartition(size_t (&order)[MAX_VERTICES], uint64_t& sideB) const;
+
+        // The depth-first search of Algorithms::isContainsCycle for a cycle closing back on its root.
+        // Returns the number of vertices of the cycle stored in path, 0 if there is none.
+        size_t findCycle(size_t (&path)[MAX_VERTICES]) const;
+
+        // Path from start to end with the fewest edges, each vertex preceded by the vertex one level
+        // closer to start that Algorithms' Bellman-Ford keeps on equal distances.
+        // Returns the number of vertices stored in path, 0 if end is unreachable.
+        size_t shortestPath(size_t start, size_t end, size_t (&path)[MAX_VERTICES]) const;
+
+    private:
+        size_t numVertices;
+        uint64_t out[MAX_VERTICES]; // out[u] bit v: edge u->v
+        uint64_t in[MAX_VERTICES];  // in[v] bit u: edge u->v
+
+        // Mask of all the vertices
+        uint64_t allVertices() const;
+    };
+
+} // namespace ariel
+
+#endif // BITGRAPH_HPP
@@ -0,0 +1,93 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "CSR.hpp"
+
+namespace ariel {
+
+    // Constructor
+    CSRGraph::CSRGraph() : numVertices(0), offsets(1, 0) {}
+
+    CSRGraph CSRGraph::fromGraph(const Graph& graph, bool transpose) {
+        CSRGraph csr;
+        auto V = static_cast<size_t>(graph.getNumVertices());
+        csr.numVertices = V;
+        csr.offsets.assign(V + 1, 0);
+
+        // A packed undirected graph is its own transpose: read each pair once and emit both directions
+        if (graph.getStorage() == GraphStorage::Symmetric) {
+            for (size_t v = 1; v < V; ++v) {
+                for (size_t u = 0; u < v; ++u) {
+                    if (graph.isEdge(u, v)) {
+                        csr.offsets[u + 1]++;
+                        csr.offsets[v + 1]++;
+                    }
+                }
+            }
+            for (size_t u = 0; u < V; ++u) {
+                csr.offsets[u + 1] += csr.offsets[u];
+            }
+            csr.targets.resize(csr.offsets[V]);
+            csr.weights.resize(csr.offsets[V]);
+            std::vector<size_t> fill(csr.offsets.begin(), csr.offsets.end() - 1);
+            // Row u gets its smaller neighbors while scanning earlier rows, then its larger ones, so rows stay sorted
+            for (size_t u = 0; u < V; ++u) {
+                for (size_t v = u + 1; v < V; ++v) {
+                    int weight = graph.getWeight(u, v);
+                    if (weight != 0) {
+                        csr.targets[fill[u]] = v;
+                        csr.weights[fill[u]++] = weight;
+                        csr.targets[fill[v]] = u;
+                        csr.weights[fill[v]++] = weight;
+                    }
+                }
+            }
+            return csr;
+        }
+
+        // A mapped CSR file already holds the rows: copy them without scanning the matrix
+        const MappedGraph<int>* file = graph.mappedFile();
+        if (file != nullptr && file->layout() == GraphFileLayout::CSR && !transpose) {
+            for (size_t u = 0; u < V; ++u) {
+                csr.offsets[u + 1] = static_cast<size_t>(file->rowBegin(u + 1));
+            }
+            csr.targets.assign(file->targets(), file->targets() + csr.offsets[V]);
+            csr.weights.assign(file->values(), file->values() + csr.offsets[V]);
+            return csr;
+        }
+
+        // Count the edges of every row first so the arrays are allocated once
+        for (size_t u = 0; u < V; ++u) {
+            for (size_t v = 0; v < V; ++v) {
+                if (graph.isEdge(u, v)) {
+                    csr.offsets[(transpose ? v : u) + 1]++;
+                }
+            }
+        }
+        for (size_t u = 0; u < V; ++u) {
+            csr.offsets[u + 1] += csr.offsets[u];
+        }
+
+        csr.targets.resize(csr.offsets[V]);
+        csr.weights.resize(csr.offsets[V]);
+        std::vector<size_t> fill(csr.offsets.begin(), csr.offsets.end() - 1);
+        for (size_t u = 0; u < V; ++u) {
+            for (size_t v = 0; v < V; ++v) {
+                if (graph.isEdge(u, v)) {
+                    size_t row = transpose ? v : u;
+                    size_t slot = fill[row]++;
+                    csr.targets[slot] = transpose ? u : v;
+                    csr.weights[slot] = graph.getWeight(u, v);
+                }
+            }
+        }
+        return csr;
+    }
+
+    size_t CSRGraph::numEdges() const {
+        return targets.size();
+    }
+
+} // namespace ariel
@@ -0,0 +1,34 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef CSR_HPP
+#define CSR_HPP
+
+#include "Graph.hpp"
+#include <vector>
+
+namespace ariel {
+
+    // Compressed sparse row copy of a Graph's adjacency matrix.
+    // The out-edges of vertex u are targets/weights[offsets[u] .. offsets[u + 1]).
+    struct CSRGraph {
+        size_t numVertices;
+        std::vector<size_t> offsets;
+        std::vector<size_t> targets;
+        std::vector<int> weights;
+
+        // Constructor
+        CSRGraph();
+
+        // Build the adjacency lists of the graph, or of its transpose (in-edges) when transpose is set
+        static CSRGraph fromGraph(const Graph& graph, bool transpose = false);
+
+        // Number of stored edges
+        size_t numEdges() const;
+    };
+
+} // namespace ariel
+
+#endif // CSR_HPP
@@ -0,0 +1,216 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "Components.hpp"
+#include "Parallel.hpp"
+#include <atomic>
+#include <limits>
+#include <random>
+#include <unordered_map>
+
+namespace ariel {
+
+    // Constructor
+    DisjointSet::DisjointSet(size_t n) : parent(n), rank(n, 0), numSets(n) {
+        for (size_t i = 0; i < n; ++i) {
+            parent[i] = i;
+        }
+    }
+
+    size_t DisjointSet::find(size_t x) {
+        size_t root = x;
+        while (parent[root] != root) {
+            root = parent[root];
+        }
+        // Point every vertex on the way straight at the root
+        while (parent[x] != root) {
+            size_t next = parent[x];
+            parent[x] = root;
+            x = next;
+        }
+        return root;
+    }
+
+    bool DisjointSet::unite(size_t a, size_t b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) {
+            return false;
+        }
+        if (rank[a] < rank[b]) {
+            parent[a] = b;
+        } else if (rank[a] > rank[b]) {
+            parent[b] = a;
+        } else {
+            parent[b] = a;
+            rank[a]++;
+        }
+        numSets--;
+        return true;
+    }
+
+    size_t DisjointSet::count() const {
+        return numSets;
+    }
+
+    size_t Components::count() const {
+        return sizes.size();
+    }
+
+    Components Components::fromGraph(const Graph& graph) {
+        auto V = static_cast<size_t>(graph.getNumVertices());
+        DisjointSet sets(V);
+        for (size_t u = 0; u < V; ++u) {
+            for (size_t v = u + 1; v < V; ++v) {
+                if (graph.isEdge(u, v) || graph.isEdge(v, u)) {
+                    sets.unite(u, v);
+                }
+            }
+        }
+        return fromDisjointSet(sets, V);
+    }
+
+    namespace {
+        // Neighbor rounds sampled before the largest component is identified
+        const size_t SAMPLE_ROUNDS = 2;
+        // Vertices sampled to find the largest intermediate component
+        const size_t SAMPLE_SIZE = 1024;
+
+        typedef std::vector<std::atomic<size_t>> ParentArray;
+
+        // Hook the trees of u and v together, always pointing the higher root at the lower one
+        void link(ParentArray& parent, size_t u, size_t v) {
+            size_t p1 = parent[u].load(std::memory_order_relaxed);
+            size_t p2 = parent[v].load(std::memory_order_relaxed);
+            while (p1 != p2) {
+                size_t high = p1 > p2 ? p1 : p2;
+                size_t low = p1 + p2 - high;
+                size_t parentHigh = parent[high].load(std::memory_order_relaxed);
+                if (parentHigh == low) {
+                    break; // Already linked
+                }
+                if (parentHigh == high && parent[high].compare_exchange_strong(parentHigh, low)) {
+                    break; // high was a root and now hangs under low
+                }
+                p1 = parent[parent[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+                p2 = parent[low].load(std::memory_order_relaxed);
+            }
+        }
+
+        // Point every vertex directly at its root
+        void compress(ParentArray& parent, unsigned numThreads) {
+            parallelFor(parent.size(), numThreads, [&](size_t v) {
+                size_t p = parent[v].load(std::memory_order_relaxed);
+                size_t grandparent = parent[p].load(std::memory_order_relaxed);
+                while (p != grandparent) {
+                    parent[v].store(grandparent, std::memory_order_relaxed);
+                    p = grandparent;
+                    grandparent = parent[p].load(std::memory_order_relaxed);
+                }
+            });
+        }
+    }
+
+    Components Components::parallelFromGraph(const Graph& graph, unsigned numThreads) {
+        auto V = static_cast<size_t>(graph.getNumVertices());
+        if (numThreads == 0) {
+            numThreads = defaultThreadCount();
+        }
+
+        // Weak connectivity needs both edge directions unless the matrix is symmetric
+        bool symmetric = graph.isSymmetric();
+        auto adjacent = [&](size_t u, size_t v) {
+            return graph.isEdge(u, v) || (!symmetric && graph.isEdge(v, u));
+        };
+        // Rows are scanned in place; cursor[u] is the first column not yet linked for u
+        std::vector<size_t> cursor(V, 0);
+
+        ParentArray parent(V);
+        parallelFor(V, numThreads, [&](size_t v) {
+            parent[v].store(v, std::memory_order_relaxed);
+        });
+
+        // Subgraph sampling: link a couple of neighbors per vertex, usually enough to form the giant component
+        for (size_t round = 0; round < SAMPLE_ROUNDS; ++round) {
+            parallelFor(V, numThreads, [&](size_t u) {
+                size_t v = cursor[u];
+                while (v < V && !adjacent(u, v)) {
+                    v++;
+                }
+                if (v < V) {
+                    link(parent, u, v);
+                    v++;
+                }
+                cursor[u] = v;
+            });
+            compress(parent, numThreads);
+        }
+
+        // Most frequent root among random vertices
+        size_t largest = 0;
+        if (V > 0) {
+            std::mt19937_64 rng(V);
+            std::uniform_int_distribution<size_t> pick(0, V - 1);
+            std::unordered_map<size_t, size_t> counts;
+            size_t best = 0;
+            for (size_t i = 0; i < SAMPLE_SIZE; ++i) {
+                size_t root = parent[pick(rng)].load(std::memory_order_relaxed);
+                if (++counts[root] > best) {
+                    best = counts[root];
+                    largest = root;
+                }
+            }
+        }
+
+        // Rows of the largest component are skipped entirely. Every edge is seen from both
+        // endpoints, so an edge into the giant component is still linked from the outside.
+        parallelFor(V, numThreads, [&](size_t u) {
+            if (parent[u].load(std::memory_order_relaxed) == largest) {
+                return;
+            }
+            for (size_t v = cursor[u]; v < V; ++v) {
+                if (adjacent(u, v)) {
+                    link(parent, u, v);
+                }
+            }
+        });
+        compress(parent, numThreads);
+
+        // Roots are the smallest vertex of their component, so numbering by first appearance
+        // matches the sequential labelling
+        const size_t unnumbered = std::numeric_limits<size_t>::max();
+        std::vector<size_t> rootLabel(V, unnumbered);
+        Components components;
+        components.id.resize(V);
+        for (size_t v = 0; v < V; ++v) {
+            size_t root = parent[v].load(std::memory_order_relaxed);
+            if (rootLabel[root] == unnumbered) {
+                rootLabel[root] = components.sizes.size();
+                components.sizes.push_back(0);
+            }
+            components.id[v] = rootLabel[root];
+            components.sizes[rootLabel[root]]++;
+        }
+        return components;
+    }
+
+    Components Components::fromDisjointSet(DisjointSet& sets, size_t n) {
+        const size_t unnumbered = std::numeric_limits<size_t>::max();
+        std::vector<size_t> rootLabel(n, unnumbered);
+        Components components;
+        components.id.resize(n);
+        for (size_t v = 0; v < n; ++v) {
+            size_t root = sets.find(v);
+            if (rootLabel[root] == unnumbered) {
+                rootLabel[root] = components.sizes.size();
+                components.sizes.push_back(0);
+            }
+            components.id[v] = rootLabel[root];
+            components.sizes[rootLabel[root]]++;
+        }
+        return components;
+    }
+
+} // namespace ariel
@@ -0,0 +1,58 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef COMPONENTS_HPP
+#define COMPONENTS_HPP
+
+#include "Graph.hpp"
+#include <vector>
+
+namespace ariel {
+
+    // Disjoint-set forest with path compression and union by rank
+    class DisjointSet {
+    public:
+        // Constructor - n singleton sets
+        explicit DisjointSet(size_t n);
+
+        // Representative of the set containing x
+        size_t find(size_t x);
+
+        // Merge the sets of a and b, returns false if they were already the same set
+        bool unite(size_t a, size_t b);
+
+        // Number of disjoint sets
+        size_t count() const;
+
+    private:
+        std::vector<size_t> parent;
+        std::vector<unsigned char> rank;
+        size_t numSets;
+    };
+
+    // Connected components of a graph, edges taken in either direction (weak connectivity)
+    struct Components {
+        std::vector<size_t> id;    // Component of every vertex, numbered by their smallest vertex
+        std::vector<size_t> sizes; // Number of vertices in every component
+
+        // Number of components
+        size_t count() const;
+
+        // Label the components of graph with a union-find pass over its edges
+        static Components fromGraph(const Graph& graph);
+
+        // Multithreaded labelling for large graphs (Afforest): a lock-free union-find linked with
+        // CAS first processes two sampled neighbors per vertex, then skips the rows of the
+        // largest intermediate component while linking the remaining edges.
+        // numThreads = 0 uses every hardware thread.
+        static Components parallelFromGraph(const Graph& graph, unsigned numThreads = 0);
+
+        // Number the sets of a disjoint-set forest over n vertices
+        static Components fromDisjointSet(DisjointSet& sets, size_t n);
+    };
+
+} // namespace ariel
+
+#endif // COMPONENTS_HPP
@@ -0,0 +1,294 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "CompressedGraph.hpp"
+#include "Varint.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace ariel {
+
+    const size_t CompressedGraph::DEFAULT_WINDOW;
+    const size_t CompressedGraph::DEFAULT_MAX_CHAIN;
+    const size_t CompressedGraph::ANCHOR_STRIDE;
+
+    namespace {
+        // Decoding of data this class wrote itself, so the bounds are known to hold
+        inline uint64_t nextVarint(const unsigned char*& p) {
+            uint64_t value = 0;
+            for (unsigned shift = 0;; shift += 7) {
+                unsigned char byte = *p++;
+                value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+                if (byte < 0x80) {
+                    return value;
+                }
+            }
+        }
+    }
+
+    // Constructor
+    CompressedGraph::CompressedGraph(size_t numVertices, size_t window, size_t maxChain)
+        : numVertices(numVertices), numAppended(0), numArcs(0), window(window), maxChain(maxChain),
+          recent(window), recentChain(window, 0) {
+        if (numVertices > std::numeric_limits<uint32_t>::max()) {
+            throw std::invalid_argument("Invalid graph: Compressed graphs hold fewer than 2^32 vertices.");
+        }
+        deltas.reserve(numVertices);
+        anchors.reserve(numVertices / ANCHOR_STRIDE + 1);
+    }
+
+    CompressedGraph CompressedGraph::fromGraph(const Graph& graph, size_t window) {
+        auto V = static_cast<size_t>(graph.getNumVertices());
+        CompressedGraph compressed(V, window);
+        std::vector<uint32_t> row;
+        for (size_t u = 0; u < V; ++u) {
+            row.clear();
+            for (size_t v = 0; v < V; ++v) {
+                if (graph.isEdge(u, v)) {
+                    row.push_back(static_cast<uint32_t>(v));
+                }
+            }
+            compressed.appendList(row.data(), row.size());
+        }
+        return compressed;
+    }
+
+    CompressedGraph CompressedGraph::fromCSR(const CSRGraph& csr, size_t window) {
+        CompressedGraph compressed(csr.numVertices, window);
+        std::vector<uint32_t> row;
+        for (size_t u = 0; u < csr.numVertices; ++u) {
+            row.clear();
+            for (size_t e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e) {
+                row.push_back(static_cast<uint32_t>(csr.targets[e]));
+            }
+            std::sort(row.begin(), row.end()); // Not every CSR keeps its rows sorted
+            row.erase(std::unique(row.begin(), row.end()), row.end());
+            compressed.appendList(row.data(), row.size());
+        }
+        return compressed;
+    }
+
+    size_t CompressedGraph::appendList(const uint32_t* neighbors, size_t count) {
+        if (numAppended == numVertices) {
+            throw std::invalid_argument("Invalid graph: Every vertex already has its list.");
+        }
+        for (size_t i = 0; i < count; ++i) {
+            if (neighbors[i] >= numVertices || (i > 0 && neighbors[i] <= neighbors[i - 1])) {
+                throw std::invalid_argument("Invalid graph: Neighbor lists must be increasing vertex ids.");
+            }
+        }
+        const size_t u = numAppended;
+        if (u % ANCHOR_STRIDE == 0) {
+            anchors.push_back(bytes.size());
+        }
+        if (bytes.size() - anchors.back() > std::numeric_limits<uint32_t>::max()) {
+            throw std::invalid_argument("Invalid graph: A block of 64 lists is over 4 GB.");
+        }
+        deltas.push_back(static_cast<uint32_t>(bytes.size() - anchors.back()));
+
+        // Pick the reference in the window that encodes shortest
+        std::vector<uint32_t> list(neighbors, neighbors + count);
+        size_t best = 0;
+        encoded.clear();
+        encodeList(encoded, u, list, 0, nullptr);
+        for (size_t r = 1; r <= window && r <= u && count > 0; ++r) {
+            size_t slot = (u - r) % window;
+            if (recentChain[slot] >= maxChain || recent[slot].empty()) {
+                continue;
+            }
+            candidate.clear();
+            encodeList(candidate, u, list, r, &recent[slot]);
+            if (candidate.size() < encoded.size()) {
+                encoded.swap(candidate);
+                best = r;
+            }
+        }
+        bytes.insert(bytes.end(), encoded.begin(), encoded.end());
+        numArcs += count;
+        if (window > 0) {
+            size_t chain = best == 0 ? 0 : recentChain[(u - best) % window] + 1;
+            recent[u % window].swap(list);
+            recentChain[u % window] = chain;
+        }
+        if (++numAppended == numVertices) {
+            // Done: release the build-time state
+            std::vector<std::vector<uint32_t>>().swap(recent);
+            std::vector<unsigned char>().swap(encoded);
+            std::vector<unsigned char>().swap(candidate);
+            bytes.shrink_to_fit();
+        }
+        return u;
+    }
+
+    void CompressedGraph::encodeList(std::vector<unsigned char>& out, size_t u, const std::vector<uint32_t>& list, size_t r, const std::vector<uint32_t>* reference) {
+        appendVarint(out, list.size());
+        if (list.empty()) {
+            return;
+        }
+        if (window > 0) {
+            appendVarint(out, r);
+        }
+        residual.clear();
+        if (reference != nullptr) {
+            // Runs of the reference list alternately copied and skipped, starting with a copy run
+            runs.clear();
+            bool copying = true;
+            uint64_t run = 0;
+            size_t i = 0;
+            for (uint32_t target : *reference) {
+                while (i < list.size() && list[i] < target) {
+                    residual.push_back(list[i++]);
+                }
+                bool shared = i < list.size() && list[i] == target;
+                if (shared) {
+                    ++i;
+                }
+                if (shared != copying) {
+                    runs.push_back(run);
+                    copying = !copying;
+                    run = 0;
+                }
+                ++run;
+            }
+            if (copying) {
+                runs.push_back(run); // A trailing skip run is implied
+            }
+            residual.insert(residual.end(), list.begin() + static_cast<std::ptrdiff_t>(i), list.end());
+            appendVarint(out, runs.size());
+            for (uint64_t length : runs) {
+                appendVarint(out, length);
+            }
+        } else {
+            residual.assign(list.begin(), list.end());
+        }
+        for (size_t k = 0; k < residual.size(); ++k) {
+            if (k == 0) {
+                appendVarint(out, zigzagEncode(static_cast<int64_t>(residual[0]) - static_cast<int64_t>(u)));
+            } else {
+                appendVarint(out, residual[k] - residual[k - 1] - 1);
+            }
+        }
+    }
+
+    const unsigned char* CompressedGraph::listStart(size_t u) const {
+        return bytes.data() + anchors[u / ANCHOR_STRIDE] + deltas[u];
+    }
+
+    void CompressedGraph::expandList(const CompressedGraph& graph, size_t u, std::vector<std::vector<uint32_t>>& levels, size_t depth) {
+        std::vector<uint32_t>& out = levels[depth];
+        out.clear();
+        const unsigned char* p = graph.listStart(u);
+        uint64_t degree = nextVarint(p);
+        if (degree == 0) {
+            return;
+        }
+        uint64_t r = graph.window > 0 ? nextVarint(p) : 0;
+        std::vector<uint32_t>& copied = levels[depth + 1];
+        if (r > 0) {
+            // Copy blocks from the reference list, which is expanded one level deeper first
+            expandList(graph, u - r, levels, depth + 1);
+            uint64_t numRuns = nextVarint(p);
+            size_t at = 0;
+            size_t kept = 0; // Compacted in place: kept never passes at
+            for (uint64_t b = 0; b < numRuns; ++b) {
+                auto length = static_cast<size_t>(nextVarint(p));
+                for (size_t i = 0; b % 2 == 0 && i < length; ++i) {
+                    copied[kept++] = copied[at + i];
+                }
+                at += length;
+            }
+            copied.resize(kept);
+        } else {
+            copied.clear();
+        }
+
+        // Merge the copied neighbors with the residual ones
+        size_t numResidual = static_cast<size_t>(degree) - copied.size();
+        size_t c = 0;
+        int64_t previous = 0;
+        for (size_t k = 0; k < numResidual; ++k) {
+            int64_t target = k == 0 ? static_cast<int64_t>(u) + zigzagDecode(nextVarint(p))
+                                    : previous + 1 + static_cast<int64_t>(nextVarint(p));
+            previous = target;
+            while (c < copied.size() && copied[c] < target) {
+                out.push_back(copied[c++]);
+            }
+            out.push_back(static_cast<uint32_t>(target));
+        }
+        out.insert(out.end(), copied.begin() + static_cast<std::ptrdiff_t>(c), copied.end());
+    }
+
+    bool CompressedGraph::isComplete() const {
+        return numAppended == numVertices;
+    }
+
+    size_t CompressedGraph::getNumVertices() const {
+        return numVertices;
+    }
+
+    size_t CompressedGraph::numEdges() const {
+        return numArcs;
+    }
+
+    size_t CompressedGraph::storageBytes() const {
+        return bytes.size() + anchors.size() * sizeof(uint64_t) + deltas.size() * sizeof(uint32_t);
+    }
+
+    double CompressedGraph::bitsPerEdge() const {
+        return numArcs == 0 ? 0 : static_cast<double>(storageBytes()) * 8 / static_cast<double>(numArcs);
+    }
+
+    // Constructor
+    CompressedGraph::NeighborIterator::NeighborIterator(const CompressedGraph& graph)
+        : graph(&graph), position(nullptr), remaining(0), previous(0), streaming(true), first(true), vertex(0), index(0) {}
+
+    size_t CompressedGraph::NeighborIterator::reset(size_t u) {
+        if (u >= graph->numAppended) {
+            throw std::invalid_argument("Invalid vertex: Vertex out of range.");
+        }
+        vertex = u;
+        position = graph->listStart(u);
+        auto degree = static_cast<size_t>(nextVarint(position));
+        uint64_t r = degree > 0 && graph->window > 0 ? nextVarint(position) : 0;
+        if (r == 0) {
+            // Plain list: decode gaps while walking
+            streaming = true;
+            remaining = degree;
+            first = true;
+            return degree;
+        }
+        streaming = false;
+        if (levels.size() < graph->maxChain + 2) {
+            levels.resize(graph->maxChain + 2); // Deepest reference chain plus the list it copies from
+        }
+        expandList(*graph, u, levels, 0);
+        index = 0;
+        return degree;
+    }
+
+    bool CompressedGraph::NeighborIterator::next(size_t& v) {
+        if (!streaming) {
+            if (index == levels[0].size()) {
+                return false;
+            }
+            v = levels[0][index++];
+            return true;
+        }
+        if (remaining == 0) {
+            return false;
+        }
+        --remaining;
+        if (first) {
+            previous = static_cast<int64_t>(vertex) + zigzagDecode(nextVarint(position));
+            first = false;
+        } else {
+            previous += 1 + static_cast<int64_t>(nextVarint(position));
+        }
+        v = static_cast<size_t>(previous);
+        return true;
+    }
+
+} // namespace ariel
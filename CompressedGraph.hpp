@@ -0,0 +1,112 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef COMPRESSEDGRAPH_HPP
+#define COMPRESSEDGRAPH_HPP
+
+#include "Graph.hpp"
+#include "CSR.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace ariel {
+
+    // Read-only adjacency (edges only, no weights) compressed like WebGraph, for graphs whose CSR
+    // doesn't fit in memory. Every sorted neighbor list is stored as varints:
+    //   degree, then (when window > 0) the distance r to a reference list, 0 for none
+    //   r > 0: the number of copy blocks and their lengths, alternately copying and skipping
+    //          neighbors of list u - r (neighbors after the last block are skipped)
+    //   the remaining neighbors: the first as a zigzag difference from u, the others as gaps - 1
+    // Similar consecutive lists (common in web and social graphs) shrink to a few bytes. References are
+    // chained at most maxChain deep so decoding a list touches a bounded number of other lists.
+    class CompressedGraph {
+    public:
+        static const size_t DEFAULT_WINDOW = 7;
+        static const size_t DEFAULT_MAX_CHAIN = 3;
+
+        // Empty graph of numVertices vertices whose lists are appended in order. window = 0 turns
+        // reference compression off.
+        explicit CompressedGraph(size_t numVertices, size_t window = DEFAULT_WINDOW, size_t maxChain = DEFAULT_MAX_CHAIN);
+
+        // Compress the out-edges of a graph, row by row, without building a CSR copy
+        static CompressedGraph fromGraph(const Graph& graph, size_t window = DEFAULT_WINDOW);
+
+        // Compress an adjacency list that is already built
+        static CompressedGraph fromCSR(const CSRGraph& csr, size_t window = DEFAULT_WINDOW);
+
+        // Append the list of the next vertex, returns its id. neighbors must be strictly increasing ids
+        // below getNumVertices().
+        size_t appendList(const uint32_t* neighbors, size_t count);
+
+        // Check that every vertex has its list
+        bool isComplete() const;
+
+        size_t getNumVertices() const;
+        size_t numEdges() const;
+
+        // Bytes of the encoded lists plus the offset index
+        size_t storageBytes() const;
+
+        // storageBytes() in bits per edge
+        double bitsPerEdge() const;
+
+        // Walks one list at a time in increasing order. Lists without a reference are decoded while
+        // walking; the others are expanded into buffers the iterator reuses. One iterator per thread.
+        class NeighborIterator {
+        public:
+            explicit NeighborIterator(const CompressedGraph& graph);
+
+            // Start on the list of u, returns its degree
+            size_t reset(size_t u);
+
+            // Next neighbor, false at the end of the list
+            bool next(size_t& v);
+
+        private:
+            const CompressedGraph* graph;
+            const unsigned char* position; // Streamed list
+            size_t remaining;
+            int64_t previous;
+            bool streaming;
+            bool first;
+            size_t vertex;
+            std::vector<std::vector<uint32_t>> levels; // Expanded lists, one per reference depth
+            size_t index;
+        };
+
+    private:
+        size_t numVertices;
+        size_t numAppended;
+        size_t numArcs;
+        size_t window;
+        size_t maxChain;
+        std::vector<unsigned char> bytes;
+        std::vector<uint64_t> anchors; // Start of the lists of vertices 64k .. 64k + 63
+        std::vector<uint32_t> deltas;  // Start of every list relative to its anchor
+
+        // Build-time state: the last window lists and their reference depths
+        std::vector<std::vector<uint32_t>> recent;
+        std::vector<size_t> recentChain;
+        std::vector<unsigned char> encoded;
+        std::vector<unsigned char> candidate;
+        std::vector<uint32_t> residual;
+        std::vector<uint64_t> runs;
+
+        static const size_t ANCHOR_STRIDE = 64;
+
+        // Helper method to find where the list of u starts
+        const unsigned char* listStart(size_t u) const;
+
+        // Helper method to encode list of u against the list r back (reference, r = 0 for none) into out
+        void encodeList(std::vector<unsigned char>& out, size_t u, const std::vector<uint32_t>& list, size_t r, const std::vector<uint32_t>* reference);
+
+        // Helper method to expand the list of u into levels[depth] (and deeper levels for its references).
+        // levels needs maxChain + 2 entries.
+        static void expandList(const CompressedGraph& graph, size_t u, std::vector<std::vector<uint32_t>>& levels, size_t depth);
+    };
+
+} // namespace ariel
+
+#endif // COMPRESSEDGRAPH_HPP
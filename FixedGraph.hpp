@@ -0,0 +1,384 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef FIXEDGRAPH_HPP
+#define FIXEDGRAPH_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ariel {
+
+    // Graph with a compile-time vertex count, stored inline (no allocation) and usable in constant
+    // expressions. Meant for many tiny graphs: every loop has the constant bound N, so the compiler
+    // can unroll it. Weights follow Graph: 0 is "no edge", the diagonal must be 0.
+    // The weights are a plain array rather than std::array because std::array's mutating accessors
+    // only became constexpr in C++17.
+    template <size_t N>
+    class FixedGraph {
+        static_assert(N > 0, "FixedGraph needs at least one vertex");
+
+    public:
+        // Constructor - no edges
+        constexpr FixedGraph() : weights{} {}
+
+        // Constructor - from N rows of N weights
+        constexpr FixedGraph(std::initializer_list<std::initializer_list<int>> rows) : weights{} {
+            if (rows.size() != N) {
+                throw std::invalid_argument("Invalid graph: The graph is not a square matrix.");
+            }
+            size_t i = 0;
+            for (const auto& row : rows) {
+                if (row.size() != N) {
+                    throw std::invalid_argument("Invalid graph: The graph is not a square matrix.");
+                }
+                size_t j = 0;
+                for (int weight : row) {
+                    weights[i][j++] = weight;
+                }
+                i++;
+            }
+            checkDiagonal();
+        }
+
+        constexpr size_t getNumVertices() const { return N; }
+        constexpr int getWeight(size_t u, size_t v) const { return weights[u][v]; }
+        constexpr bool isEdge(size_t u, size_t v) const { return weights[u][v] != 0; }
+
+        constexpr int getNumEdges() const {
+            int edges = 0;
+            for (size_t i = 0; i < N; ++i) {
+                for (size_t j = 0; j < N; ++j) {
+                    edges += weights[i][j] != 0 ? 1 : 0;
+                }
+            }
+            return edges;
+        }
+
+        // Set the weight of u->v, 0 removes the edge
+        constexpr void setWeight(size_t u, size_t v, int weight) {
+            if (u >= N || v >= N) {
+                throw std::invalid_argument("Invalid edge: Vertex out of range.");
+            }
+            if (u == v && weight != 0) {
+                throw std::invalid_argument("Invalid edge: Self-loops are not allowed.");
+            }
+            weights[u][v] = weight;
+        }
+
+        // Copy into the adjacency matrix Graph::loadGraph takes
+        std::vector<std::vector<int>> toMatrix() const {
+            std::vector<std::vector<int>> matrix(N, std::vector<int>(N, 0));
+            for (size_t i = 0; i < N; ++i) {
+                for (size_t j = 0; j < N; ++j) {
+                    matrix[i][j] = weights[i][j];
+                }
+            }
+            return matrix;
+        }
+
+        // Operator +
+        constexpr FixedGraph operator+(const FixedGraph& other) const {
+            FixedGraph result;
+            for (size_t i = 0; i < N; ++i) {
+                for (size_t j = 0; j < N; ++j) {
+                    result.weights[i][j] = weights[i][j] + other.weights[i][j];
+                }
+            }
+            return result;
+        }
+
+        // Operator -
+        constexpr FixedGraph operator-(const FixedGraph& other) const {
+            return *this + (-other);
+        }
+
+        // Unary Operator -
+        constexpr FixedGraph operator-() const {
+            return *this * -1;
+        }
+
+        // Operator * - unlike Graph's, returns a scaled copy so it stays usable in constant expressions
+        constexpr FixedGraph operator*(int scalar) const {
+            FixedGraph result;
+            for (size_t i = 0; i < N; ++i) {
+                for (size_t j = 0; j < N; ++j) {
+                    result.weights[i][j] = weights[i][j] * scalar;
+                }
+            }
+            return result;
+        }
+
+        // Operator * - matrix product with a zero diagonal, as Graph's
+        constexpr FixedGraph operator*(const FixedGraph& other) const {
+            FixedGraph result;
+            for (size_t i = 0; i < N; ++i) {
+                for (size_t k = 0; k < N; ++k) {
+                    for (size_t j = 0; j < N; ++j) {
+                        result.weights[i][j] += weights[i][k] * other.weights[k][j];
+                    }
+                }
+                result.weights[i][i] = 0;
+            }
+            return result;
+        }
+
+        // Operator ==
+        constexpr bool operator==(const FixedGraph& other) const {
+            for (size_t i = 0; i < N; ++i) {
+                for (size_t j = 0; j < N; ++j) {
+                    if (weights[i][j] != other.weights[i][j]) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        // Operator !=
+        constexpr bool operator!=(const FixedGraph& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        int weights[N][N];
+
+        constexpr void checkDiagonal() const {
+            for (size_t i = 0; i < N; ++i) {
+                if (weights[i][i] != 0) {
+                    throw std::invalid_argument("Invalid graph: The graph contains non-zero diagonal elements.");
+                }
+            }
+        }
+    };
+
+    // Outcome of FixedAlgorithms::shortestPath
+    enum class PathStatus { Found, NoPath, NegativeCycle, InvalidVertex, ToItself };
+
+    // Shortest path between two vertices of a FixedGraph<N>, held inline
+    template <size_t N>
+    struct FixedPath {
+        PathStatus status;
+        size_t start;
+        size_t end;
+        long long distance;
+        size_t length;       // Number of vertices on the path
+        size_t vertices[N];  // vertices[0 .. length)
+
+        constexpr FixedPath() : status(PathStatus::NoPath), start(0), end(0), distance(0), length(0), vertices{} {}
+
+        // The message Algorithms::shortestPath gives for the same graph and query
+        std::string toString() const {
+            switch (status) {
+                case PathStatus::ToItself:
+                    return "Invalid request - path to itself";
+                case PathStatus::InvalidVertex:
+                    return "Invalid start or end vertex";
+                case PathStatus::NegativeCycle:
+                    return "Negative cycle detected";
+                case PathStatus::NoPath:
+                    return "There is no path between " + std::to_string(start) + " and " + std::to_string(end);
+                default:
+                    break;
+            }
+            std::string path;
+            for (size_t i = 0; i < length; ++i) {
+                path += std::to_string(vertices[i]);
+                if (i + 1 < length) {
+                    path += "->";
+                }
+            }
+            return path;
+        }
+    };
+
+    // Algorithms' classic queries for FixedGraph, as constexpr functions on fixed-size stack arrays.
+    // They follow the same traversal orders as Algorithms, so their answers match.
+    class FixedAlgorithms {
+    public:
+        // Every vertex is reachable from vertex 0
+        template <size_t N>
+        static constexpr bool isConnected(const FixedGraph<N>& graph) {
+            bool visited[N] = {};
+            size_t queue[N] = {};
+            size_t head = 0;
+            size_t tail = 0;
+            queue[tail++] = 0;
+            visited[0] = true;
+            while (head < tail) {
+                size_t u = queue[head++];
+                for (size_t v = 0; v < N; ++v) {
+                    if (graph.isEdge(u, v) && !visited[v]) {
+                        visited[v] = true;
+                        queue[tail++] = v;
+                    }
+                }
+            }
+            return tail == N;
+        }
+
+        // A BFS 2-coloring succeeds and both sides are non-empty
+        template <size_t N>
+        static constexpr bool isBipartite(const FixedGraph<N>& graph) {
+            int color[N] = {};  // 0 uncolored, 1 or 2
+            size_t queue[N] = {};
+            size_t sizeA = 0;
+            size_t sizeB = 0;
+            for (size_t i = 0; i < N; ++i) {
+                if (color[i] != 0) {
+                    continue;
+                }
+                size_t head = 0;
+                size_t tail = 0;
+                queue[tail++] = i;
+                color[i] = 1;
+                sizeA++;
+                while (head < tail) {
+                    size_t u = queue[head++];
+                    for (size_t v = 0; v < N; ++v) {
+                        if (!graph.isEdge(u, v)) {
+                            continue;
+                        }
+                        if (color[v] == 0) {
+                            color[v] = 3 - color[u];
+                            (color[v] == 1 ? sizeA : sizeB)++;
+                            queue[tail++] = v;
+                        } else if (color[v] == color[u]) {
+                            return false;
+                        }
+                    }
+                }
+            }
+            return sizeA > 0 && sizeB > 0;
+        }
+
+        // Bellman-Ford from vertex 0 finds an edge that still relaxes
+        template <size_t N>
+        static constexpr bool negativeCycle(const FixedGraph<N>& graph) {
+            long long dist[N] = {};
+            bool reached[N] = {};
+            size_t prev[N] = {};
+            reached[0] = true;
+            return relaxAll(graph, dist, reached, prev);
+        }
+
+        // A depth-first search closes a cycle back to its root (the search Algorithms::isContainsCycle
+        // runs, on explicit stacks), or there is a negative cycle
+        template <size_t N>
+        static constexpr bool containsCycle(const FixedGraph<N>& graph) {
+            bool visited[N] = {};
+            size_t vertex[N] = {};
+            size_t parent[N] = {};
+            size_t next[N] = {};
+            for (size_t root = 0; root < N; ++root) {
+                if (visited[root]) {
+                    continue;
+                }
+                size_t depth = 1;
+                vertex[0] = root;
+                parent[0] = N; // No parent
+                next[0] = 0;
+                visited[root] = true;
+                while (depth > 0) {
+                    size_t top = depth - 1;
+                    if (next[top] == N) {
+                        depth--;
+                        continue;
+                    }
+                    size_t u = next[top]++;
+                    if (!graph.isEdge(vertex[top], u)) {
+                        continue;
+                    }
+                    if (!visited[u]) {
+                        visited[u] = true;
+                        vertex[depth] = u;
+                        parent[depth] = vertex[top];
+                        next[depth] = 0;
+                        depth++;
+                    } else if (u != parent[top] && u == root) {
+                        return true;
+                    }
+                }
+            }
+            return negativeCycle(graph);
+        }
+
+        // Bellman-Ford shortest path from start to end, negative weights allowed
+        template <size_t N>
+        static constexpr FixedPath<N> shortestPath(const FixedGraph<N>& graph, size_t start, size_t end) {
+            FixedPath<N> result;
+            result.start = start;
+            result.end = end;
+            if (start == end) {
+                result.status = PathStatus::ToItself;
+                return result;
+            }
+            if (start >= N || end >= N) {
+                result.status = PathStatus::InvalidVertex;
+                return result;
+            }
+
+            long long dist[N] = {};
+            bool reached[N] = {};
+            size_t prev[N] = {};
+            for (size_t v = 0; v < N; ++v) {
+                prev[v] = N;
+            }
+            reached[start] = true;
+            if (relaxAll(graph, dist, reached, prev)) {
+                result.status = PathStatus::NegativeCycle;
+                return result;
+            }
+            if (!reached[end]) {
+                result.status = PathStatus::NoPath;
+                return result;
+            }
+
+            result.status = PathStatus::Found;
+            result.distance = dist[end];
+            for (size_t v = end; v != N; v = prev[v]) {
+                result.vertices[result.length++] = v;
+            }
+            for (size_t i = 0; i < result.length / 2; ++i) {
+                size_t swap = result.vertices[i];
+                result.vertices[i] = result.vertices[result.length - 1 - i];
+                result.vertices[result.length - 1 - i] = swap;
+            }
+            return result;
+        }
+
+    private:
+        // Helper method to run N - 1 Bellman-Ford rounds in Algorithms' loop order, then report
+        // whether any edge still relaxes
+        template <size_t N>
+        static constexpr bool relaxAll(const FixedGraph<N>& graph, long long (&dist)[N], bool (&reached)[N], size_t (&prev)[N]) {
+            for (size_t round = 0; round + 1 < N; ++round) {
+                for (size_t u = 0; u < N; ++u) {
+                    for (size_t v = 0; v < N; ++v) {
+                        if (graph.isEdge(u, v) && reached[u] && (!reached[v] || dist[u] + graph.getWeight(u, v) < dist[v])) {
+                            dist[v] = dist[u] + graph.getWeight(u, v);
+                            reached[v] = true;
+                            prev[v] = u;
+                        }
+                    }
+                }
+            }
+            for (size_t u = 0; u < N; ++u) {
+                for (size_t v = 0; v < N; ++v) {
+                    if (graph.isEdge(u, v) && reached[u] && (!reached[v] || dist[u] + graph.getWeight(u, v) < dist[v])) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+    };
+
+} // namespace ariel
+
+#endif // FIXEDGRAPH_HPP
@@ -1,15 +1,150 @@
     #include "Graph.hpp"
+    #include "LandmarkIndex.hpp"
+    #include "Components.hpp"
+    #include "SCC.hpp"
+    #include "TopologicalSort.hpp"
+    #include "TransitiveClosure.hpp"
+    #include "SemiringMatrix.hpp"
+    #include "SpGEMM.hpp"
+    #include "Strassen.hpp"
+    #include "IncrementalConnectivity.hpp"
+    #include "Varint.hpp"
     #include <iostream>
+    #include <fstream>
+    #include <cstring>
+    #include <algorithm>
+    #include <limits>
     #include <stdexcept>
+    #include <type_traits>
 
     namespace ariel {
+        namespace {
+            // operator* multiplies sparsely when both graphs fill at most 1/16 of their matrix
+            const size_t SPARSE_PRODUCT_MAX_DENSITY = 16;
+            // Graphs this large multiply with Strassen-Winograd when both are at least half full
+            const size_t STRASSEN_MIN_VERTICES = 512;
+            // restoreSnapshot reads payloads from unseekable streams this many bytes at a time
+            const size_t SNAPSHOT_CHUNK_BYTES = size_t(1) << 20;
+
+            // out = a * b, accumulated in WeightTraits<Weight>::Sum on the blocked plus-times kernel
+            template <typename Weight>
+            void multiplyMatrices(const BasicGraph<Weight>& a, const BasicGraph<Weight>& b, std::vector<std::vector<Weight>>& out) {
+                typedef BasicPlusTimes<typename WeightTraits<Weight>::Sum> Ring;
+                SemiringMatrix<Ring> product = SemiringMatrix<Ring>::fromGraph(a) * SemiringMatrix<Ring>::fromGraph(b);
+                for (size_t i = 0; i < out.size(); ++i) {
+                    for (size_t j = 0; j < out.size(); ++j) {
+                        out[i][j] = static_cast<Weight>(product(i, j));
+                    }
+                }
+            }
+
+            // int graphs also have Gustavson's sparse product when both sides are sparse, and
+            // Strassen-Winograd when both are large and dense
+            void multiplyMatrices(const Graph& a, const Graph& b, std::vector<std::vector<int>>& out) {
+                size_t n = out.size();
+                size_t cells = n * n;
+                auto edgesA = static_cast<size_t>(a.getNumEdges());
+                auto edgesB = static_cast<size_t>(b.getNumEdges());
+                if (edgesA * SPARSE_PRODUCT_MAX_DENSITY <= cells && edgesB * SPARSE_PRODUCT_MAX_DENSITY <= cells) {
+                    SparseProduct product = SparseProduct::multiply(CSRGraph::fromGraph(a), CSRGraph::fromGraph(b));
+                    for (size_t i = 0; i < n; ++i) {
+                        for (size_t e = product.offsets[i]; e < product.offsets[i + 1]; ++e) {
+                            out[i][product.columns[e]] = static_cast<int>(product.values[e]);
+                        }
+                    }
+                    return;
+                }
+                if (n < STRASSEN_MIN_VERTICES || edgesA * 2 < cells || edgesB * 2 < cells) {
+                    multiplyMatrices<int>(a, b, out);
+                    return;
+                }
+                SemiringMatrix<PlusTimes> left = SemiringMatrix<PlusTimes>::fromGraph(a);
+                SemiringMatrix<PlusTimes> right = SemiringMatrix<PlusTimes>::fromGraph(b);
+                SemiringMatrix<PlusTimes> product(n);
+                Strassen::multiply(n, left.data(), right.data(), product.data());
+                for (size_t i = 0; i < n; ++i) {
+                    for (size_t j = 0; j < n; ++j) {
+                        out[i][j] = static_cast<int>(product(i, j));
+                    }
+                }
+            }
+
+            // Snapshot weights: zigzag varints for integer types, raw bytes for floating point ones
+            template <typename Weight>
+            void appendWeight(std::vector<unsigned char>& out, Weight weight, std::true_type) {
+                appendVarint(out, zigzagEncode(static_cast<int64_t>(weight)));
+            }
+
+            template <typename Weight>
+            void appendWeight(std::vector<unsigned char>& out, Weight weight, std::false_type) {
+                const auto* bytes = reinterpret_cast<const unsigned char*>(&weight);
+                out.insert(out.end(), bytes, bytes + sizeof(Weight));
+            }
+
+            template <typename Weight>
+            bool readWeight(const unsigned char*& p, const unsigned char* end, Weight& weight, std::true_type) {
+                uint64_t raw = 0;
+                if (!readVarint(p, end, raw)) {
+                    return false;
+                }
+                int64_t value = zigzagDecode(raw);
+                weight = static_cast<Weight>(value);
+                return static_cast<int64_t>(weight) == value;
+            }
+
+            template <typename Weight>
+            bool readWeight(const unsigned char*& p, const unsigned char* end, Weight& weight, std::false_type) {
+                if (static_cast<size_t>(end - p) < sizeof(Weight)) {
+                    return false;
+                }
+                std::memcpy(&weight, p, sizeof(Weight));
+                p += sizeof(Weight);
+                return true;
+            }
+
+            // Walk a sparse snapshot payload, calling sink(line, index, weight) for every nonzero cell.
+            // A line is a row of V cells, or column line of the packed triangle (line cells) when symmetric.
+            // Returns false if the payload is malformed.
+            template <typename Weight, typename Sink>
+            bool decodeSparse(const std::vector<unsigned char>& payload, size_t V, bool symmetric, Sink sink) {
+                const unsigned char* p = payload.data();
+                const unsigned char* end = p + payload.size();
+                for (size_t line = 0; line < V; ++line) {
+                    uint64_t length = symmetric ? line : V;
+                    uint64_t count = 0;
+                    if (!readVarint(p, end, count) || count > length) {
+                        return false;
+                    }
+                    uint64_t next = 0;
+                    for (uint64_t c = 0; c < count; ++c) {
+                        uint64_t gap = 0;
+                        Weight weight = 0;
+                        if (!readVarint(p, end, gap) || gap >= length - next ||
+                            !readWeight(p, end, weight, typename std::is_integral<Weight>::type())) {
+                            return false;
+                        }
+                        auto index = static_cast<size_t>(next + gap);
+                        next = index + 1;
+                        if (!symmetric && index == line && weight != 0) {
+                            return false; // Diagonal
+                        }
+                        sink(line, index, weight);
+                    }
+                }
+                return p == end;
+            }
+        }
+
         // Constructor
-        Graph::Graph() : numVertices(0), numEdges(0) {}
+        template <typename Weight>
+        BasicGraph<Weight>::BasicGraph() : storage(GraphStorage::Full), numVertices(0), numEdges(0), numNegativeEdges(0), maxWeight(0), numAsymmetricPairs(0), numMaxWeightEdges(0), positiveWeightsKnown(false) {}
 
         // Destructor
-        Graph::~Graph() {}
+        template <typename Weight>
+        BasicGraph<Weight>::~BasicGraph() {}
 
-        void Graph::loadGraph(const std::vector<std::vector<int>>& graph) {
+        template <typename Weight>
+        void BasicGraph<Weight>::loadGraph(const std::vector<std::vector<Weight>>& graph) {
             // Check if the graph is empty
             if (graph.empty()) {
                 throw std::invalid_argument("Invalid graph: The graph is empty.");
@@ -27,24 +162,439 @@
                 }
             }
 
-            // Assign the graph to the member variable
-            this->graph = graph;
+            // Assign the graph to the member variable (a mapped file is replaced by a full matrix)
+            if (storage == GraphStorage::Mapped) {
+                mapped.reset();
+                storage = GraphStorage::Full;
+            }
+            if (storage == GraphStorage::Symmetric) {
+                for (size_t i = 0; i < graph.size(); ++i) {
+                    for (size_t j = i + 1; j < graph.size(); ++j) {
+                        if (graph[i][j] != graph[j][i]) {
+                            throw std::invalid_argument("Invalid graph: Symmetric storage needs a symmetric matrix.");
+                        }
+                    }
+                }
+                upper.assign(graph.size() * (graph.size() - 1) / 2, 0);
+                for (size_t v = 1; v < graph.size(); ++v) {
+                    for (size_t u = 0; u < v; ++u) {
+                        upper[v * (v - 1) / 2 + u] = graph[u][v];
+                    }
+                }
+            } else {
+                this->graph = graph;
+            }
 
             // Calculate number of vertices and edges
             numVertices = graph.size();
-            numEdges = calculateNumEdges(graph);
+            refreshCachedState();
         }
 
-        void Graph::printGraph() {
+        template <typename Weight>
+        void BasicGraph<Weight>::setStorage(GraphStorage mode) {
+            if (mode == storage) {
+                return;
+            }
+            if (mode == GraphStorage::Mapped) {
+                throw std::invalid_argument("Invalid storage: Graph files are mapped by loadGraphFile.");
+            }
+            if (mode == GraphStorage::Symmetric) {
+                if (!isSymmetric()) {
+                    throw std::invalid_argument("Invalid storage: Symmetric storage needs a symmetric graph.");
+                }
+                std::vector<Weight> packed(numVertices * (numVertices - 1) / 2, 0);
+                for (size_t v = 1; v < numVertices; ++v) {
+                    for (size_t u = 0; u < v; ++u) {
+                        packed[v * (v - 1) / 2 + u] = at(u, v);
+                    }
+                }
+                upper.swap(packed);
+                std::vector<std::vector<Weight>>().swap(graph); // Release the full matrix
+            } else {
+                graph = getGraph();
+                std::vector<Weight>().swap(upper);
+            }
+            mapped.reset();
+            storage = mode;
+        }
+
+        template <typename Weight>
+        GraphStorage BasicGraph<Weight>::getStorage() const {
+            return storage;
+        }
+
+        template <typename Weight>
+        size_t BasicGraph<Weight>::storageBytes() const {
+            if (storage == GraphStorage::Symmetric) {
+                return upper.size() * sizeof(Weight);
+            }
+            if (storage == GraphStorage::Mapped) {
+                return 0;
+            }
+            return numVertices * numVertices * sizeof(Weight);
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::saveGraphFile(const std::string& path, GraphFileLayout layout) const {
+            if (numVertices == 0) {
+                throw std::invalid_argument("Invalid graph: The graph is empty.");
+            }
+            const auto V = static_cast<uint64_t>(numVertices);
+            const auto E = static_cast<uint64_t>(numEdges);
+            if (layout == GraphFileLayout::Auto) {
+                bool sparse = (V + 1) * sizeof(uint64_t) + E * (sizeof(uint32_t) + sizeof(Weight)) < V * V * sizeof(Weight);
+                layout = sparse ? GraphFileLayout::CSR : GraphFileLayout::Dense;
+            }
+            if (layout == GraphFileLayout::CSR && V >= (uint64_t(1) << 32)) {
+                throw std::invalid_argument("Invalid graph file: CSR files hold fewer than 2^32 vertices.");
+            }
+
+            // Header, then each array at the next 64-byte boundary
+            GraphFileHeader header;
+            std::memset(&header, 0, sizeof(header));
+            std::memcpy(header.magic, "ARIELGR", 8);
+            header.version = GraphFileHeader::VERSION;
+            header.byteOrder = GraphFileHeader::ENDIAN_MARK;
+            header.layout = static_cast<uint32_t>(layout);
+            header.weightCode = graphFileWeightCode<Weight>();
+            header.numVertices = V;
+            header.numEdges = E;
+            header.numNegativeEdges = numNegativeEdges;
+            header.numAsymmetricPairs = numAsymmetricPairs;
+            header.numMaxWeightEdges = numMaxWeightEdges;
+            std::memcpy(header.maxWeight, &maxWeight, sizeof(Weight));
+            auto align = [](uint64_t pos) { return (pos + 63) / 64 * 64; };
+            uint64_t end = sizeof(GraphFileHeader);
+            if (layout == GraphFileLayout::CSR) {
+                header.offsetsPos = align(end);
+                header.targetsPos = align(header.offsetsPos + (V + 1) * sizeof(uint64_t));
+                header.valuesPos = align(header.targetsPos + E * sizeof(uint32_t));
+                end = header.valuesPos + E * sizeof(Weight);
+            } else {
+                header.valuesPos = align(end);
+                end = header.valuesPos + V * V * sizeof(Weight);
+            }
+            header.fileBytes = end;
+
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                throw std::invalid_argument("Invalid graph file: Can't write " + path + ".");
+            }
+            uint64_t written = 0;
+            auto write = [&](uint64_t pos, const void* data, uint64_t bytes) {
+                static const char zeros[64] = {};
+                out.write(zeros, static_cast<std::streamsize>(pos - written)); // Padding up to pos
+                out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+                written = pos + bytes;
+            };
+            write(0, &header, sizeof(header));
+            if (layout == GraphFileLayout::CSR) {
+                std::vector<uint64_t> offsets(numVertices + 1, 0);
+                std::vector<uint32_t> targets;
+                std::vector<Weight> values;
+                targets.reserve(E);
+                values.reserve(E);
+                for (size_t u = 0; u < numVertices; ++u) {
+                    for (size_t v = 0; v < numVertices; ++v) {
+                        Weight weight = at(u, v);
+                        if (weight != 0) {
+                            targets.push_back(static_cast<uint32_t>(v));
+                            values.push_back(weight);
+                        }
+                    }
+                    offsets[u + 1] = targets.size();
+                }
+                write(header.offsetsPos, offsets.data(), offsets.size() * sizeof(uint64_t));
+                write(header.targetsPos, targets.data(), targets.size() * sizeof(uint32_t));
+                write(header.valuesPos, values.data(), values.size() * sizeof(Weight));
+            } else {
+                std::vector<Weight> row(numVertices);
+                for (size_t u = 0; u < numVertices; ++u) {
+                    for (size_t v = 0; v < numVertices; ++v) {
+                        row[v] = at(u, v);
+                    }
+                    write(u == 0 ? header.valuesPos : written, row.data(), row.size() * sizeof(Weight));
+                }
+            }
+            if (!out) {
+                throw std::invalid_argument("Invalid graph file: Writing " + path + " failed.");
+            }
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::loadGraphFile(const std::string& path) {
+            std::shared_ptr<const MappedGraph<Weight>> file = MappedGraph<Weight>::open(path);
+            const GraphFileHeader& header = file->header();
+            std::vector<std::vector<Weight>>().swap(graph);
+            std::vector<Weight>().swap(upper);
+            mapped = file;
+            storage = GraphStorage::Mapped;
+
+            // The statistics come from the header instead of a scan
+            numVertices = static_cast<size_t>(header.numVertices);
+            numEdges = static_cast<int>(header.numEdges);
+            numNegativeEdges = static_cast<int>(header.numNegativeEdges);
+            numAsymmetricPairs = static_cast<int>(header.numAsymmetricPairs);
+            numMaxWeightEdges = static_cast<int>(header.numMaxWeightEdges);
+            std::memcpy(&maxWeight, header.maxWeight, sizeof(Weight));
+            positiveWeights.clear();
+            positiveWeightsKnown = false;
+            dropDerivedData();
+            connectivityTracker.reset();
+        }
+
+        template <typename Weight>
+        const MappedGraph<Weight>* BasicGraph<Weight>::mappedFile() const {
+            return mapped.get();
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::saveSnapshot(std::ostream& out) const {
+            if (numVertices == 0) {
+                throw std::invalid_argument("Invalid graph: The graph is empty.");
+            }
+            const bool symmetric = storage == GraphStorage::Symmetric;
+            const size_t cells = symmetric ? upper.size() : numVertices * numVertices;
+            const auto stored = static_cast<size_t>(symmetric ? numEdges / 2 : numEdges); // A packed cell is two edges
+            const bool sparse = stored * (sizeof(Weight) + 2) < cells * sizeof(Weight);
+
+            GraphSnapshotHeader header;
+            std::memset(&header, 0, sizeof(header));
+            std::memcpy(header.magic, "ARIELSN", 8);
+            header.version = GraphSnapshotHeader::VERSION;
+            header.byteOrder = GraphFileHeader::ENDIAN_MARK;
+            header.weightCode = graphFileWeightCode<Weight>();
+            header.flags = (sparse ? GraphSnapshotHeader::SPARSE : 0) | (symmetric ? GraphSnapshotHeader::SYMMETRIC : 0);
+            header.numVertices = numVertices;
+            header.numEdges = numEdges;
+            header.numNegativeEdges = numNegativeEdges;
+            header.numAsymmetricPairs = numAsymmetricPairs;
+            header.numMaxWeightEdges = numMaxWeightEdges;
+            std::memcpy(header.maxWeight, &maxWeight, sizeof(Weight));
+
+            if (sparse) {
+                // Encode everything first so the payload goes out in one write
+                std::vector<unsigned char> payload;
+                std::vector<unsigned char> line;
+                payload.reserve(numVertices + stored * (sizeof(Weight) + 2));
+                for (size_t i = 0; i < numVertices; ++i) {
+                    size_t length = symmetric ? i : numVertices;
+                    uint64_t count = 0;
+                    size_t next = 0;
+                    line.clear();
+                    for (size_t j = 0; j < length; ++j) {
+                        Weight weight = symmetric ? upper[i * (i - 1) / 2 + j] : at(i, j);
+                        if (weight != 0) {
+                            appendVarint(line, j - next);
+                            appendWeight(line, weight, typename std::is_integral<Weight>::type());
+                            next = j + 1;
+                            count++;
+                        }
+                    }
+                    appendVarint(payload, count);
+                    payload.insert(payload.end(), line.begin(), line.end());
+                }
+                header.payloadBytes = payload.size();
+                out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                out.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+            } else {
+                header.payloadBytes = cells * sizeof(Weight);
+                out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                if (symmetric) {
+                    out.write(reinterpret_cast<const char*>(upper.data()), static_cast<std::streamsize>(header.payloadBytes));
+                } else if (storage == GraphStorage::Mapped && mapped->layout() == GraphFileLayout::Dense) {
+                    out.write(reinterpret_cast<const char*>(mapped->values()), static_cast<std::streamsize>(header.payloadBytes));
+                } else {
+                    std::vector<Weight> row(numVertices);
+                    for (size_t i = 0; i < numVertices; ++i) {
+                        const Weight* data = graph.empty() ? row.data() : graph[i].data();
+                        for (size_t j = 0; graph.empty() && j < numVertices; ++j) {
+                            row[j] = at(i, j); // Mapped CSR rows
+                        }
+                        out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(numVertices * sizeof(Weight)));
+                    }
+                }
+            }
+            if (!out) {
+                throw std::invalid_argument("Invalid snapshot: Writing failed.");
+            }
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::restoreSnapshot(std::istream& in) {
+            GraphSnapshotHeader header;
+            if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+                throw std::invalid_argument("Invalid snapshot: The header is truncated.");
+            }
+            if (std::memcmp(header.magic, "ARIELSN", 8) != 0 || header.version != GraphSnapshotHeader::VERSION ||
+                header.byteOrder != GraphFileHeader::ENDIAN_MARK) {
+                throw std::invalid_argument("Invalid snapshot: Not a graph snapshot of this version.");
+            }
+            if (header.weightCode != graphFileWeightCode<Weight>()) {
+                throw std::invalid_argument("Invalid snapshot: The weight type doesn't match the graph.");
+            }
+            const uint64_t V = header.numVertices;
+            const bool symmetric = (header.flags & GraphSnapshotHeader::SYMMETRIC) != 0;
+            const bool sparse = (header.flags & GraphSnapshotHeader::SPARSE) != 0;
+            // A dense matrix of 2^28 vertices is already 2^56 cells, so this bound keeps every size
+            // computed below (at most about 2^61 bytes) from wrapping around
+            if (V == 0 || V > (uint64_t(1) << 28)) {
+                throw std::invalid_argument("Invalid snapshot: Bad vertex count.");
+            }
+            const uint64_t cells = symmetric ? V * (V - 1) / 2 : V * V;
+            const uint64_t limit = sparse ? V * 10 + cells * (10 + sizeof(Weight)) : cells * sizeof(Weight);
+            if ((sparse ? header.payloadBytes > limit : header.payloadBytes != limit) ||
+                header.payloadBytes > std::numeric_limits<size_t>::max()) {
+                throw std::invalid_argument("Invalid snapshot: Bad payload size.");
+            }
+
+            // The payload is checked completely before the graph is touched. Nothing is allocated for
+            // bytes the stream doesn't have: a seekable stream must hold the whole payload up front,
+            // any other one is read in chunks and fails on the first missing byte.
+            std::vector<unsigned char> payload;
+            std::streampos position = in.tellg();
+            if (position != std::streampos(-1)) {
+                in.seekg(0, std::ios::end);
+                std::streampos end = in.tellg();
+                in.seekg(position);
+                if (end == std::streampos(-1) || static_cast<uint64_t>(end - position) < header.payloadBytes) {
+                    throw std::invalid_argument("Invalid snapshot: The payload is truncated.");
+                }
+                payload.reserve(static_cast<size_t>(header.payloadBytes));
+            }
+            while (payload.size() < header.payloadBytes) {
+                size_t offset = payload.size();
+                auto chunk = static_cast<size_t>(std::min<uint64_t>(SNAPSHOT_CHUNK_BYTES, header.payloadBytes - offset));
+                payload.resize(offset + chunk);
+                in.read(reinterpret_cast<char*>(payload.data() + offset), static_cast<std::streamsize>(chunk));
+                if (static_cast<size_t>(in.gcount()) != chunk) {
+                    throw std::invalid_argument("Invalid snapshot: The payload is truncated.");
+                }
+            }
+            const auto n = static_cast<size_t>(V);
+            if (sparse) {
+                if (!decodeSparse<Weight>(payload, n, symmetric, [](size_t, size_t, Weight) {})) {
+                    throw std::invalid_argument("Invalid snapshot: The sparse payload is malformed.");
+                }
+            } else if (!symmetric) {
+                const auto* cellsData = reinterpret_cast<const Weight*>(payload.data());
+                for (size_t i = 0; i < n; ++i) {
+                    if (cellsData[i * n + i] != 0) {
+                        throw std::invalid_argument("Invalid graph: The graph contains non-zero diagonal elements.");
+                    }
+                }
+            }
+
+            // Fill the storage in place, reusing the rows already there
+            mapped.reset();
+            if (symmetric) {
+                std::vector<std::vector<Weight>>().swap(graph);
+                upper.resize(static_cast<size_t>(cells));
+                if (sparse) {
+                    std::fill(upper.begin(), upper.end(), Weight(0));
+                    decodeSparse<Weight>(payload, n, true, [this](size_t v, size_t u, Weight weight) {
+                        upper[v * (v - 1) / 2 + u] = weight;
+                    });
+                } else {
+                    std::memcpy(upper.data(), payload.data(), payload.size());
+                }
+            } else {
+                std::vector<Weight>().swap(upper);
+                graph.resize(n);
+                for (size_t i = 0; i < n; ++i) {
+                    graph[i].resize(n);
+                    if (sparse) {
+                        std::fill(graph[i].begin(), graph[i].end(), Weight(0));
+                    } else {
+                        std::memcpy(graph[i].data(), payload.data() + i * n * sizeof(Weight), n * sizeof(Weight));
+                    }
+                }
+                if (sparse) {
+                    decodeSparse<Weight>(payload, n, false, [this](size_t u, size_t v, Weight weight) {
+                        graph[u][v] = weight;
+                    });
+                }
+            }
+            storage = symmetric ? GraphStorage::Symmetric : GraphStorage::Full;
+            numVertices = n;
+            numEdges = static_cast<int>(header.numEdges);
+            numNegativeEdges = static_cast<int>(header.numNegativeEdges);
+            numAsymmetricPairs = static_cast<int>(header.numAsymmetricPairs);
+            numMaxWeightEdges = static_cast<int>(header.numMaxWeightEdges);
+            std::memcpy(&maxWeight, header.maxWeight, sizeof(Weight));
+            positiveWeights.clear();
+            positiveWeightsKnown = false;
+            dropDerivedData();
+            connectivityTracker.reset();
+        }
+
+        template <typename Weight>
+        Weight BasicGraph<Weight>::at(size_t u, size_t v) const {
+            if (storage == GraphStorage::Full) {
+                return graph[u][v];
+            }
+            if (storage == GraphStorage::Mapped) {
+                return mapped->weight(u, v);
+            }
+            if (u == v) {
+                return 0;
+            }
+            return u < v ? upper[v * (v - 1) / 2 + u] : upper[u * (u - 1) / 2 + v];
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::store(size_t u, size_t v, Weight weight) {
+            if (storage == GraphStorage::Mapped) {
+                setStorage(GraphStorage::Full); // Copy on write
+            }
+            if (storage == GraphStorage::Full) {
+                graph[u][v] = weight;
+            } else if (u != v) {
+                (u < v ? upper[v * (v - 1) / 2 + u] : upper[u * (u - 1) / 2 + v]) = weight;
+            }
+        }
+
+        template <typename Weight>
+        template <typename Transform>
+        void BasicGraph<Weight>::transformCells(Transform transform) {
+            if (storage == GraphStorage::Mapped) {
+                setStorage(GraphStorage::Full);
+            }
+            if (storage == GraphStorage::Full) {
+                for (size_t i = 0; i < numVertices; ++i) {
+                    for (size_t j = 0; j < numVertices; ++j) {
+                        graph[i][j] = transform(i, j, graph[i][j]);
+                    }
+                }
+                return;
+            }
+            for (size_t v = 1; v < numVertices; ++v) {
+                for (size_t u = 0; u < v; ++u) {
+                    Weight& weight = upper[v * (v - 1) / 2 + u];
+                    weight = transform(u, v, weight);
+                }
+            }
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::adoptStorage(GraphStorage mode) {
+            if (mode == GraphStorage::Symmetric && isSymmetric()) {
+                setStorage(GraphStorage::Symmetric);
+            }
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::printGraph() {
             std::cout << "Graph with " << numVertices << " vertices and " << numEdges << " edges." << std::endl;
         }
 
-        int ariel::Graph::calculateNumEdges(const std::vector<std::vector<int>>& graph) const {
+        template <typename Weight>
+        int BasicGraph<Weight>::calculateNumEdges() const {
             int edges = 0;
-            for (size_t i = 0; i < graph.size(); ++i) {
-                for (size_t j = 0; j < graph[i].size(); ++j) {
+            for (size_t i = 0; i < numVertices; ++i) {
+                for (size_t j = 0; j < numVertices; ++j) {
                     // Skip counting diagonal elements (self-loops)
-                    if (i != j && graph[i][j] != 0) {
+                    if (i != j && at(i, j) != 0) {
                         edges++;
                     }
                 }
@@ -53,21 +603,326 @@
             return edges;
         }
 
+        template <typename Weight>
+        void BasicGraph<Weight>::refreshCachedState() {
+            numEdges = calculateNumEdges();
+            numNegativeEdges = 0;
+            numAsymmetricPairs = 0;
+            maxWeight = 0;
+            numMaxWeightEdges = 0;
+            for (size_t i = 0; i < numVertices; ++i) {
+                for (size_t j = 0; j < numVertices; ++j) {
+                    Weight weight = at(i, j);
+                    if (weight < 0) {
+                        numNegativeEdges++;
+                    }
+                    if (i < j && weight != at(j, i)) {
+                        numAsymmetricPairs++;
+                    }
+                    if (weight > maxWeight) {
+                        maxWeight = weight;
+                        numMaxWeightEdges = 1;
+                    } else if (weight > 0 && weight == maxWeight) {
+                        numMaxWeightEdges++;
+                    }
+                }
+            }
+            // Per weight counts are only built if the maximum's last edge goes away
+            positiveWeights.clear();
+            positiveWeightsKnown = false;
+            dropDerivedData();
+            connectivityTracker.reset();
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::recountMaxWeight() {
+            positiveWeights.clear();
+            for (size_t i = 0; i < numVertices; ++i) {
+                for (size_t j = 0; j < numVertices; ++j) {
+                    Weight weight = at(i, j);
+                    if (weight > 0) {
+                        positiveWeights[weight]++;
+                    }
+                }
+            }
+            positiveWeightsKnown = true;
+            maxWeight = positiveWeights.empty() ? 0 : positiveWeights.rbegin()->first;
+            numMaxWeightEdges = positiveWeights.empty() ? 0 : positiveWeights.rbegin()->second;
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::dropDerivedData() {
+            landmarkIndex.reset();
+            components.reset();
+            strongComponents.reset();
+            topologicalOrder.reset();
+            transitiveClosure.reset();
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::countCell(Weight old, Weight weight) {
+            // Edge and sign counters
+            if (old == 0) {
+                numEdges++;
+            } else if (weight == 0) {
+                numEdges--;
+            }
+            numNegativeEdges += (weight < 0 ? 1 : 0) - (old < 0 ? 1 : 0);
+
+            // The maximum is exact. Until its last edge first goes away only the maximum is counted;
+            // from the recount on, the count of every positive weight is kept.
+            if (positiveWeightsKnown) {
+                if (old > 0 && --positiveWeights[old] == 0) {
+                    positiveWeights.erase(old);
+                }
+                if (weight > 0) {
+                    positiveWeights[weight]++;
+                }
+                maxWeight = positiveWeights.empty() ? 0 : positiveWeights.rbegin()->first;
+                numMaxWeightEdges = positiveWeights.empty() ? 0 : positiveWeights.rbegin()->second;
+                return;
+            }
+            if (old > 0 && old == maxWeight) {
+                numMaxWeightEdges--;
+            }
+            if (weight > maxWeight) {
+                maxWeight = weight;
+                numMaxWeightEdges = 1;
+            } else if (weight > 0 && weight == maxWeight) {
+                numMaxWeightEdges++;
+            }
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::updateCell(size_t u, size_t v, Weight weight) {
+            Weight old = at(u, v);
+            Weight mirror = at(v, u);
+            if (old == weight) {
+                return;
+            }
+            store(u, v, weight);
+
+            // With Symmetric storage v->u changes along with u->v
+            countCell(old, weight);
+            Weight mirrorAfter = mirror;
+            if (storage == GraphStorage::Symmetric) {
+                countCell(old, weight);
+                mirrorAfter = weight;
+            } else {
+                numAsymmetricPairs += (weight != mirror ? 1 : 0) - (old != mirror ? 1 : 0);
+            }
+            if (maxWeight > 0 && numMaxWeightEdges == 0) {
+                recountMaxWeight();
+            }
+
+            dropDerivedData();
+
+            // The tracker only sees undirected structure: a pair is linked while either direction is an edge
+            std::shared_ptr<IncrementalConnectivity> tracker = connectivityTracker.load();
+            if (tracker) {
+                if (weight == 0 && mirrorAfter == 0) {
+                    connectivityTracker.reset(); // Deletions aren't supported, rebuild on next use
+                } else if (old == 0 && mirror == 0) {
+                    if (tracker.use_count() > 2) { // Shared with a copy of the graph beyond the slot and this handle
+                        tracker = std::make_shared<IncrementalConnectivity>(*tracker);
+                        connectivityTracker.store(tracker);
+                    }
+                    tracker->addEdge(u, v);
+                }
+            }
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::checkEdge(size_t u, size_t v) const {
+            if (u >= numVertices || v >= numVertices) {
+                throw std::invalid_argument("Invalid edge: Vertex out of range.");
+            }
+            if (u == v) {
+                throw std::invalid_argument("Invalid edge: Self-loops are not allowed.");
+            }
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::addEdge(size_t u, size_t v, Weight weight) {
+            checkEdge(u, v);
+            if (weight == 0) {
+                throw std::invalid_argument("Invalid edge: The weight of an edge can't be 0.");
+            }
+            updateCell(u, v, weight);
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::addEdges(const std::vector<BasicEdge<Weight>>& edges) {
+            for (const BasicEdge<Weight>& edge : edges) {
+                checkEdge(edge.from, edge.to);
+                if (edge.weight == 0) {
+                    throw std::invalid_argument("Invalid edge: The weight of an edge can't be 0.");
+                }
+            }
+            for (const BasicEdge<Weight>& edge : edges) {
+                updateCell(edge.from, edge.to, edge.weight);
+            }
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::removeEdge(size_t u, size_t v) {
+            checkEdge(u, v);
+            if (at(u, v) == 0) {
+                throw std::invalid_argument("Invalid edge: There is no such edge.");
+            }
+            updateCell(u, v, 0);
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::setWeight(size_t u, size_t v, Weight weight) {
+            checkEdge(u, v);
+            if (at(u, v) == 0) {
+                throw std::invalid_argument("Invalid edge: There is no such edge.");
+            }
+            if (weight == 0) {
+                throw std::invalid_argument("Invalid edge: The weight of an edge can't be 0.");
+            }
+            updateCell(u, v, weight);
+        }
+
+        template <typename Weight>
+        size_t BasicGraph<Weight>::addVertex() {
+            if (storage == GraphStorage::Mapped) {
+                setStorage(GraphStorage::Full);
+            }
+            if (storage == GraphStorage::Symmetric) {
+                upper.resize(upper.size() + numVertices, 0); // The new column of the triangle
+            } else {
+                for (size_t i = 0; i < numVertices; ++i) {
+                    graph[i].push_back(0);
+                }
+                graph.push_back(std::vector<Weight>(numVertices + 1, 0));
+            }
+            numVertices++;
+
+            // A new isolated vertex changes no edge statistic
+            dropDerivedData();
+            std::shared_ptr<IncrementalConnectivity> tracker = connectivityTracker.load();
+            if (tracker) {
+                if (tracker.use_count() > 2) { // Shared with a copy of the graph beyond the slot and this handle
+                    tracker = std::make_shared<IncrementalConnectivity>(*tracker);
+                    connectivityTracker.store(tracker);
+                }
+                tracker->addVertex();
+            }
+            return numVertices - 1;
+        }
+
+        template <typename Weight>
+        void BasicGraph<Weight>::removeVertex(size_t v) {
+            if (v >= numVertices) {
+                throw std::invalid_argument("Invalid vertex: Vertex out of range.");
+            }
+            if (numVertices == 1) {
+                throw std::invalid_argument("Invalid graph: The graph can't be empty.");
+            }
+            if (storage == GraphStorage::Mapped) {
+                setStorage(GraphStorage::Full);
+            }
+
+            // Drop the edges of v so the statistics stay exact
+            for (size_t i = 0; i < numVertices; ++i) {
+                if (at(v, i) != 0) {
+                    updateCell(v, i, 0);
+                }
+                if (at(i, v) != 0) {
+                    updateCell(i, v, 0);
+                }
+            }
 
-        std::vector<std::vector<int>> Graph::getGraph() const {
-            return graph; // Return the adjacency matrix
+            // Move the last vertex into slot v, then shrink the matrix by one row and column
+            size_t last = numVertices - 1;
+            if (storage == GraphStorage::Symmetric) {
+                for (size_t i = 0; v != last && i < last; ++i) {
+                    store(i, v, at(i, last));
+                }
+                upper.resize(last * (last - 1) / 2); // The last column of the triangle is the last vertex
+            } else {
+                if (v != last) {
+                    graph[v].swap(graph[last]);
+                    for (size_t i = 0; i < numVertices; ++i) {
+                        graph[i][v] = graph[i][last];
+                    }
+                }
+                graph.pop_back();
+                for (size_t i = 0; i < last; ++i) {
+                    graph[i].pop_back();
+                }
+            }
+            numVertices--;
+
+            dropDerivedData();
+            connectivityTracker.reset();
+        }
+
+        template <typename Weight>
+        const IncrementalConnectivity& BasicGraph<Weight>::connectivity() const {
+            return *derived(connectivityTracker, [this]() {
+                auto tracker = std::make_shared<IncrementalConnectivity>(numVertices);
+                for (size_t u = 0; u < numVertices; ++u) {
+                    for (size_t v = u + 1; v < numVertices; ++v) {
+                        if (at(u, v) != 0 || at(v, u) != 0) {
+                            tracker->addEdge(u, v);
+                        }
+                    }
+                }
+                return tracker;
+            });
+        }
+
+
+        template <typename Weight>
+        std::vector<std::vector<Weight>> BasicGraph<Weight>::getGraph() const {
+            if (storage == GraphStorage::Full) {
+                return graph; // Return the adjacency matrix
+            }
+            std::vector<std::vector<Weight>> matrix(numVertices, std::vector<Weight>(numVertices, 0));
+            for (size_t u = 0; u < numVertices; ++u) {
+                for (size_t v = 0; v < numVertices; ++v) {
+                    matrix[u][v] = at(u, v);
+                }
+            }
+            return matrix;
         }
 
-        int Graph::getNumVertices() const {
+        template <typename Weight>
+        int BasicGraph<Weight>::getNumVertices() const {
             return numVertices; // Return the number of vertices
         }
 
-        int Graph::getNumEdges() const {
+        template <typename Weight>
+        int BasicGraph<Weight>::getNumEdges() const {
             return numEdges; // Return the number of edges
         }
 
-        bool Graph::isEdge(std::vector<std::vector<int>>::size_type u, std::vector<std::vector<int>>::size_type v) const {
-            return graph[u][v] != 0; // Check if there is an edge between u and v
+        template <typename Weight>
+        Weight BasicGraph<Weight>::getWeight(size_t u, size_t v) const {
+            return at(u, v); // Return the weight of the edge u->v, 0 if there is none
+        }
+
+        template <typename Weight>
+        Weight BasicGraph<Weight>::getMaxWeight() const {
+            return maxWeight;
+        }
+
+        template <typename Weight>
+        bool BasicGraph<Weight>::hasNegativeWeights() const {
+            return numNegativeEdges > 0;
+        }
+
+        template <typename Weight>
+        bool BasicGraph<Weight>::isSymmetric() const {
+            return numAsymmetricPairs == 0;
+        }
+
+        template <typename Weight>
+        bool BasicGraph<Weight>::isEdge(std::vector<std::vector<int>>::size_type u, std::vector<std::vector<int>>::size_type v) const {
+            return at(u, v) != 0; // Check if there is an edge between u and v
         }
 
         // --------------------------------------------------------------
@@ -75,22 +930,23 @@
         //PART B - OPERATORS
 
         // Member function to check if the current graph is valid
-        bool Graph::validGraph() const {
+        template <typename Weight>
+        bool BasicGraph<Weight>::validGraph() const {
             // Check if the graph is empty
-            if (this->graph.empty()) {
+            if (this->numVertices == 0) {
                 throw std::invalid_argument("Invalid graph: The graph is empty.");
                 return false;
             }
 
-            // Check if the graph is square
-            if (this->graph.size() != this->graph[0].size()) {
+            // Check if the graph is square (the packed triangle always is)
+            if (this->storage == GraphStorage::Full && this->graph.size() != this->graph[0].size()) {
                 throw std::invalid_argument("Invalid graph: The graph is not a square matrix.");
                 return false;
             }
 
             // Check if the graph contains non-zero diagonal elements
-            for (size_t i = 0; i < this->graph.size(); ++i) {
-                if (this->graph[i][i] != 0) {
+            for (size_t i = 0; i < this->numVertices; ++i) {
+                if (this->at(i, i) != 0) {
                     throw std::invalid_argument("Invalid graph: The graph contains non-zero diagonal elements.");
                     return false;
                 }
@@ -100,63 +956,68 @@
         }
 
         // Operator +
-        Graph Graph::operator+(const Graph& other) const {
+        template <typename Weight>
+        BasicGraph<Weight> BasicGraph<Weight>::operator+(const BasicGraph& other) const {
             if (this->numVertices != other.numVertices) {
                 throw std::invalid_argument("Graphs must have the same dimensions to be added.");
             }
 
-            std::vector<std::vector<int>> result = this->graph;
+            std::vector<std::vector<Weight>> result = this->getGraph();
 
             for (size_t i = 0; i < result.size(); ++i) {
                 for (size_t j = 0; j < result[i].size(); ++j) {
-                    result[i][j] += other.graph[i][j];
+                    result[i][j] += other.at(i, j);
                 }
             }
 
-            Graph newGraph;
+            BasicGraph newGraph;
             newGraph.loadGraph(result);
             if (!newGraph.validGraph()) {
                 throw std::invalid_argument("Invalid graph after addition.");
             }
+            newGraph.adoptStorage(this->storage);
             return newGraph;
         }
 
         // Operator -
-        Graph Graph::operator-(const Graph& other) const {
+        template <typename Weight>
+        BasicGraph<Weight> BasicGraph<Weight>::operator-(const BasicGraph& other) const {
             if (this->numVertices != other.numVertices) {
                 throw std::invalid_argument("Graphs must have the same dimensions to be subtracted.");
             }
 
-            std::vector<std::vector<int>> result = this->graph;
+            std::vector<std::vector<Weight>> result = this->getGraph();
 
             for (size_t i = 0; i < result.size(); ++i) {
                 for (size_t j = 0; j < result[i].size(); ++j) {
-                    result[i][j] -= other.graph[i][j];
+                    result[i][j] -= other.at(i, j);
                 }
             }
 
-            Graph newGraph;
+            BasicGraph newGraph;
             newGraph.loadGraph(result);
             if (!newGraph.validGraph()) {
                 throw std::invalid_argument("Invalid graph after subtraction.");
             }
+            newGraph.adoptStorage(this->storage);
             return newGraph;
         }
 
         // Operator +=
-        Graph& Graph::operator+=(const Graph& other) {
+        template <typename Weight>
+        BasicGraph<Weight>& BasicGraph<Weight>::operator+=(const BasicGraph& other) {
             if (this->numVertices != other.numVertices) {
                 throw std::invalid_argument("Graphs must have the same dimensions to be added.");
             }
 
-            for (size_t i = 0; i < this->graph.size(); ++i) {
-                for (size_t j = 0; j < this->graph[i].size(); ++j) {
-                    this->graph[i][j] += other.graph[i][j];
-                }
+            // A directed other turns a packed graph back into a full matrix
+            if (this->storage == GraphStorage::Symmetric && !other.isSymmetric()) {
+                this->setStorage(GraphStorage::Full);
             }
+            this->transformCells([&other](size_t i, size_t j, Weight weight) { return static_cast<Weight>(weight + other.at(i, j)); });
 
             // Recalculate the number of edges
-            this->numEdges = calculateNumEdges(this->graph);
+            this->refreshCachedState();
             if (!this->validGraph()) {
                 throw std::invalid_argument("Invalid graph after addition.");
             }
@@ -164,19 +1025,20 @@
         }
 
         // Operator -=
-        Graph& Graph::operator-=(const Graph& other) {
+        template <typename Weight>
+        BasicGraph<Weight>& BasicGraph<Weight>::operator-=(const BasicGraph& other) {
             if (this->numVertices != other.numVertices) {
                 throw std::invalid_argument("Graphs must have the same dimensions to be subtracted.");
             }
 
-            for (size_t i = 0; i < this->graph.size(); ++i) {
-                for (size_t j = 0; j < this->graph[i].size(); ++j) {
-                    this->graph[i][j] -= other.graph[i][j];
-                }
+            // A directed other turns a packed graph back into a full matrix
+            if (this->storage == GraphStorage::Symmetric && !other.isSymmetric()) {
+                this->setStorage(GraphStorage::Full);
             }
+            this->transformCells([&other](size_t i, size_t j, Weight weight) { return static_cast<Weight>(weight - other.at(i, j)); });
 
             // Recalculate the number of edges
-            this->numEdges = calculateNumEdges(this->graph);
+            this->refreshCachedState();
             if (!this->validGraph()) {
                 throw std::invalid_argument("Invalid graph after subtraction.");
             }
@@ -184,8 +1046,9 @@
         }
 
         // Unary Operator -
-        Graph Graph::operator-() const {
-            std::vector<std::vector<int>> result = this->graph;
+        template <typename Weight>
+        BasicGraph<Weight> BasicGraph<Weight>::operator-() const {
+            std::vector<std::vector<Weight>> result = this->getGraph();
 
             for (size_t i = 0; i < result.size(); ++i) {
                 for (size_t j = 0; j < result[i].size(); ++j) {
@@ -193,26 +1056,22 @@
                 }
             }
 
-            Graph newGraph;
+            BasicGraph newGraph;
             newGraph.loadGraph(result);
             if (!newGraph.validGraph()) {
                 throw std::invalid_argument("Invalid graph after unary minus.");
             }
+            newGraph.adoptStorage(this->storage);
             return newGraph;
         }
 
         // Operator ++
-        Graph& Graph::operator++() {
-            for (size_t i = 0; i < this->numVertices; ++i) {
-                for (size_t j = 0; j < this->numVertices; ++j) {
-                    if (this->graph[i][j] != 0) {
-                        // Increment each non-zero element by one
-                        this->graph[i][j]++;
-                    }
-                }
-            }
+        template <typename Weight>
+        BasicGraph<Weight>& BasicGraph<Weight>::operator++() {
+            // Increment each non-zero element by one
+            this->transformCells([](size_t, size_t, Weight weight) { return static_cast<Weight>(weight != 0 ? weight + 1 : weight); });
             // Recalculate the number of edges
-            this->numEdges = calculateNumEdges(this->graph);
+            this->refreshCachedState();
             if (!this->validGraph()) {
                 throw std::invalid_argument("Invalid graph after increment.");
             }
@@ -221,16 +1080,11 @@
 
 
         // Operator --
-        Graph& Graph::operator--() {
-            for (size_t i = 0; i < this->numVertices; ++i) {
-                for (size_t j = 0; j < this->numVertices; ++j) {
-                    if (this->graph[i][j] != 0) {
-                        this->graph[i][j]--;
-                    }
-                }
-            }
+        template <typename Weight>
+        BasicGraph<Weight>& BasicGraph<Weight>::operator--() {
+            this->transformCells([](size_t, size_t, Weight weight) { return static_cast<Weight>(weight != 0 ? weight - 1 : weight); });
             // Recalculate the number of edges
-            this->numEdges = calculateNumEdges(this->graph);
+            this->refreshCachedState();
             if (!this->validGraph()) {
                 throw std::invalid_argument("Invalid graph after decrement.");
             }
@@ -238,14 +1092,11 @@
         }
 
         // Operator *
-        Graph& Graph::operator*(int scalar) {
-            for (size_t i = 0; i < this->numVertices; ++i) {
-                for (size_t j = 0; j < this->numVertices; ++j) {
-                    this->graph[i][j] *= scalar;
-                }
-            }
+        template <typename Weight>
+        BasicGraph<Weight>& BasicGraph<Weight>::operator*(Weight scalar) {
+            this->transformCells([scalar](size_t, size_t, Weight weight) { return static_cast<Weight>(weight * scalar); });
             // Recalculate the number of edges
-            this->numEdges = calculateNumEdges(this->graph);
+            this->refreshCachedState();
             if (!this->validGraph()) {
                 throw std::invalid_argument("Invalid graph after scalar multiplication.");
             }
@@ -253,40 +1104,38 @@
         }
 
         // Operator *
-        Graph Graph::operator*(const Graph& other) const {
+        template <typename Weight>
+        BasicGraph<Weight> BasicGraph<Weight>::operator*(const BasicGraph& other) const {
             // Check if the graphs have the same number of vertices
             if (this->numVertices != other.numVertices) {
                 throw std::invalid_argument("Invalid operation: Graphs have different number of vertices.");
             }
 
             // Initialize a new graph for the result
-            Graph result;
+            BasicGraph result;
             result.numVertices = this->numVertices;
-            result.graph.resize(this->numVertices, std::vector<int>(this->numVertices, 0));
+            result.graph.resize(this->numVertices, std::vector<Weight>(this->numVertices, 0));
 
-            // Perform matrix multiplication
-            for (size_t i = 0; i < this->numVertices; ++i) {
-                for (size_t j = 0; j < this->numVertices; ++j) {
-                    for (size_t k = 0; k < this->numVertices; ++k) {
-                        result.graph[i][j] += this->graph[i][k] * other.graph[k][j];
-                    }
-                }
-            }
+            // Perform matrix multiplication in a wider type, narrowed back to Weight
+            multiplyMatrices(*this, other, result.graph);
 
             // Ensure zero-diagonal
             for (size_t i = 0; i < result.numVertices; ++i) {
                 result.graph[i][i] = 0;
             }
+            result.refreshCachedState();
 
             if (!result.validGraph()) {
                 throw std::invalid_argument("Invalid graph after matrix multiplication.");
             }
+            result.adoptStorage(this->storage);
 
             return result;
         }
 
         // Helper method to check if the current graph is fully contained within another graph
-        bool Graph::isContainedIn(const Graph& graph1, const Graph& graph2) const{
+        template <typename Weight>
+        bool BasicGraph<Weight>::isContainedIn(const BasicGraph& graph1, const BasicGraph& graph2) const{
             if (graph1.getNumVertices() > graph2.getNumVertices()) return false;
 
             int n = graph1.getNumVertices();
@@ -314,7 +1163,8 @@
 
 
         // Operator <
-        bool Graph::operator<(const Graph& other) const {
+        template <typename Weight>
+        bool BasicGraph<Weight>::operator<(const BasicGraph& other) const {
             if (isContainedIn(*this, other)) {
                 return true;
             } else if (isContainedIn(other, *this)) {
@@ -325,7 +1175,8 @@
         }
 
         // Operator >
-        bool Graph::operator>(const Graph& other) const {
+        template <typename Weight>
+        bool BasicGraph<Weight>::operator>(const BasicGraph& other) const {
             if (isContainedIn(other, *this)) {
                 return true;
             } else if (isContainedIn(*this, other)) {
@@ -336,17 +1187,15 @@
         }
 
         // Operator ==
-        bool Graph::operator==(const Graph& other) const {
+        template <typename Weight>
+        bool BasicGraph<Weight>::operator==(const BasicGraph& other) const {
             if (this->numVertices != other.numVertices) {
                 return false;
             }
 
-            const auto& g1 = this->graph;
-            const auto& g2 = other.graph;
-
             for (size_t i = 0; i < this->numVertices; ++i) {
                 for (size_t j = 0; j < this->numVertices; ++j) {
-                    if (g1[i][j] != g2[i][j]) {
+                    if (this->at(i, j) != other.at(i, j)) {
                         return false;
                     }
                 }
@@ -356,23 +1205,26 @@
         }
 
         // Operator !=
-        bool Graph::operator!=(const Graph& other) const {
+        template <typename Weight>
+        bool BasicGraph<Weight>::operator!=(const BasicGraph& other) const {
             return !(*this == other);
         }
         
         // Operator <=
-        bool Graph::operator<=(const Graph& other) const {
+        template <typename Weight>
+        bool BasicGraph<Weight>::operator<=(const BasicGraph& other) const {
             return (*this < other) || (*this == other);
         }
 
         // Operator >=
-        bool Graph::operator>=(const Graph& other) const {
+        template <typename Weight>
+        bool BasicGraph<Weight>::operator>=(const BasicGraph& other) const {
             return (*this > other) || (*this == other);
         }
 
         // Member function to print a graphical representation of the graph
-        void Graph::visualGraph() const {
-            const auto& matrix = this->graph;
+        template <typename Weight>
+        void BasicGraph<Weight>::visualGraph() const {
             size_t numVertices = this->numVertices;
 
             std::cout << "Visual Representation of the Graph:" << std::endl;
@@ -398,9 +1250,17 @@
 
                 // Print row elements
                 for (size_t j = 0; j < numVertices; ++j) {
-                    std::cout << matrix[i][j] << " ";
+                    std::cout << +this->at(i, j) << " "; // Unary + prints 8-bit weights as numbers
                 }
                 std::cout << std::endl;
             }
         }
-    }
\ No newline at end of file
+    
+        // The weight types the library is built for
+        template class BasicGraph<int8_t>;
+        template class BasicGraph<int16_t>;
+        template class BasicGraph<int32_t>;
+        template class BasicGraph<int64_t>;
+        template class BasicGraph<float>;
+        template class BasicGraph<double>;
+    }
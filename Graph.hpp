@@ -4,94 +4,307 @@
 #include <vector>
 #include <stdexcept>
 #include <string>
+#include <memory>
+#include <map>
+#include <mutex>
+#include <cstdint>
+#include <iosfwd>
+#include "GraphFile.hpp"
 
 namespace ariel {
 
-    class Graph {
+    class LandmarkIndex;
+    struct Components;
+    struct StrongComponents;
+    struct TopologicalOrder;
+    class TransitiveClosure;
+    class IncrementalConnectivity;
+    class GraphParser;
+
+    // One weighted edge from -> to, used by the batched mutation methods
+    template <typename Weight>
+    struct BasicEdge {
+        size_t from;
+        size_t to;
+        Weight weight;
+    };
+    typedef BasicEdge<int> Edge;
+
+    // Type sums and products of weights are accumulated in: 64-bit for integer weights, double for
+    // floating point ones
+    template <typename Weight>
+    struct WeightTraits {
+        typedef long long Sum;
+    };
+    template <>
+    struct WeightTraits<float> {
+        typedef double Sum;
+    };
+    template <>
+    struct WeightTraits<double> {
+        typedef double Sum;
+    };
+
+    // Slot for derived data that const queries build lazily. Loads and stores are atomic so one thread
+    // can publish while others read, copies take an atomic snapshot of the source.
+    template <typename T>
+    struct DerivedSlot {
+        std::shared_ptr<T> data;
+
+        DerivedSlot() {}
+        DerivedSlot(const DerivedSlot& other) : data(other.load()) {}
+        DerivedSlot& operator=(const DerivedSlot& other) {
+            store(other.load());
+            return *this;
+        }
+
+        std::shared_ptr<T> load() const { return std::atomic_load(&data); }
+        void store(const std::shared_ptr<T>& value) { std::atomic_store(&data, value); }
+        void reset() { store(std::shared_ptr<T>()); }
+    };
+
+    // Lock serializing the builds of derived data (recursive: one build may need another).
+    // Every graph owns its own, so copying a graph doesn't copy the lock.
+    struct DerivedLock {
+        std::recursive_mutex mutex;
+
+        DerivedLock() {}
+        DerivedLock(const DerivedLock&) {}
+        DerivedLock& operator=(const DerivedLock&) { return *this; }
+    };
+
+    // How a graph holds its adjacency matrix: Full keeps every row, Symmetric keeps only the strict
+    // upper triangle packed column by column (half the memory) and treats each pair as one undirected edge,
+    // Mapped reads a graph file mapped read-only by loadGraphFile and turns Full on the first change
+    enum class GraphStorage { Full, Symmetric, Mapped };
+
+    // Graph over an adjacency matrix of Weight. Instantiated for int8_t, int16_t, int32_t, int64_t,
+    // float and double: narrow types save memory bandwidth, wide ones add range. A weight of 0
+    // means "no edge" for every type.
+    // Thread safety: const member functions and Algorithms queries on a const graph may run from
+    // several threads at once (derived data is built once and published atomically); anything that
+    // changes the graph needs exclusive access.
+    template <typename Weight>
+    class BasicGraph {
     private:
-        std::vector<std::vector<int>> graph; // Adjacency matrix representation of the graph
+        std::vector<std::vector<Weight>> graph; // Adjacency matrix representation of the graph (Full storage)
+        std::vector<Weight> upper; // Strict upper triangle, u < v at v * (v - 1) / 2 + u (Symmetric storage)
+        std::shared_ptr<const MappedGraph<Weight>> mapped; // Graph file (Mapped storage)
+        GraphStorage storage; // Which of the three holds the edges
         size_t numVertices; // Number of vertices in the graph
         int numEdges; // Number of edges in the graph
+        int numNegativeEdges; // Number of edges with a negative weight
+        Weight maxWeight; // Largest edge weight, 0 if there are no positive weights
+        int numAsymmetricPairs; // Number of pairs u < v with graph[u][v] != graph[v][u]
+        int numMaxWeightEdges; // Number of edges weighing exactly maxWeight
+        std::map<Weight, int> positiveWeights; // Number of edges per positive weight, kept once the maximum has been recounted
+        bool positiveWeightsKnown; // Whether positiveWeights is up to date
+
+        // Derived data built lazily by Algorithms, dropped whenever the graph changes.
+        // Const queries may run from several threads at once: each piece is built once under
+        // derivedLock and published through its slot. Changing the graph needs exclusive access.
+        mutable DerivedLock derivedLock;
+        mutable DerivedSlot<const LandmarkIndex> landmarkIndex;
+        mutable DerivedSlot<const Components> components;
+        mutable DerivedSlot<const StrongComponents> strongComponents;
+        mutable DerivedSlot<const TopologicalOrder> topologicalOrder;
+        mutable DerivedSlot<const TransitiveClosure> transitiveClosure;
+
+        // Connectivity tracker, kept up to date by edge insertions once built (shared copy-on-write)
+        mutable DerivedSlot<IncrementalConnectivity> connectivityTracker;
+
+        // Helper method to return the derived data in slot, building it with build() on first use.
+        // Double-checked under derivedLock so concurrent callers build it only once.
+        template <typename T, typename Build>
+        std::shared_ptr<T> derived(DerivedSlot<T>& slot, Build build) const {
+            std::shared_ptr<T> data = slot.load();
+            if (!data) {
+                std::lock_guard<std::recursive_mutex> lock(derivedLock.mutex);
+                data = slot.load();
+                if (!data) {
+                    data = build();
+                    slot.store(data);
+                }
+            }
+            return data;
+        }
+
+        // Helper method to read the weight of u->v from either storage
+        Weight at(size_t u, size_t v) const;
+
+        // Helper method to write the weight of u->v (and of v->u with Symmetric storage)
+        void store(size_t u, size_t v, Weight weight);
+
+        // Helper method to replace every stored weight w of u->v by transform(u, v, w), visiting each
+        // undirected pair once with Symmetric storage
+        template <typename Transform>
+        void transformCells(Transform transform);
+
+        // Helper method to give a freshly built result this graph's storage when it's symmetric
+        void adoptStorage(GraphStorage mode);
 
         // Helper method to calculate the number of edges in the graph
-        int calculateNumEdges(const std::vector<std::vector<int>>& graph) const;
+        int calculateNumEdges() const;
+
+        // Helper method to update the edge, sign and maximum counters for one cell going from old to weight
+        void countCell(Weight old, Weight weight);
+
+        // Helper method to recount the edge statistics and drop derived data after a change
+        void refreshCachedState();
+
+        // Helper method to recompute maxWeight and numMaxWeightEdges with a full scan. The scan also counts
+        // the edges of every positive weight, so later changes find the next maximum in O(log E).
+        void recountMaxWeight();
+
+        // Helper method to drop the derived data built by Algorithms
+        void dropDerivedData();
+
+        // Helper method to set one cell, updating the edge statistics in O(1)
+        void updateCell(size_t u, size_t v, Weight weight);
+
+        // Helper method to throw if u->v can't be an edge of this graph
+        void checkEdge(size_t u, size_t v) const;
 
         // Member function to check if the current graph is valid
         bool validGraph() const;
 
         // Helper method to check if the current graph is fully contained within another graph
-        bool isContainedIn(const Graph& graph1, const Graph& graph2) const;
+        bool isContainedIn(const BasicGraph& graph1, const BasicGraph& graph2) const;
+
+        friend class Algorithms;
+        friend class GraphParser;
 
     public:
+        typedef Weight weight_type;
+
         // Constructor
-        Graph();
+        BasicGraph();
 
         // Destructor
-        ~Graph();
+        ~BasicGraph();
+
+        // Load graph from adjacency matrix. With Symmetric storage the matrix must be symmetric.
+        void loadGraph(const std::vector<std::vector<Weight>>& graph);
+
+        // Switch the storage mode, converting the current edges. Symmetric needs a symmetric graph.
+        // With Symmetric storage every mutation of u->v also applies to v->u.
+        void setStorage(GraphStorage mode);
+        GraphStorage getStorage() const;
+
+        // Bytes held by the adjacency storage (in memory, a mapped file counts as 0)
+        size_t storageBytes() const;
+
+        // Write the graph and its edge statistics to a graph file (see GraphFileHeader) with a few large writes
+        void saveGraphFile(const std::string& path, GraphFileLayout layout = GraphFileLayout::Auto) const;
+
+        // Map a graph file read-only as Mapped storage. Nothing is copied up front: O(1) for a Dense
+        // file, one validation pass over the rows of a CSR file.
+        void loadGraphFile(const std::string& path);
+
+        // The mapped graph file, nullptr unless the storage is Mapped
+        const MappedGraph<Weight>* mappedFile() const;
 
-        // Load graph from adjacency matrix
-        void loadGraph(const std::vector<std::vector<int>>& graph);
+        // Write a compact snapshot of the storage mode, the edges and the cached statistics to out: the
+        // raw cells, or varint gap-encoded rows when the graph is sparse (see GraphSnapshotHeader)
+        void saveSnapshot(std::ostream& out) const;
+
+        // Replace the graph by a snapshot written by saveSnapshot. The statistics are restored, not
+        // recounted, and rows of the right size are reused. On error the graph is left unchanged.
+        void restoreSnapshot(std::istream& in);
 
         // Print graph information
         void printGraph();
 
         // Getters
-        std::vector<std::vector<int>> getGraph() const;
+        std::vector<std::vector<Weight>> getGraph() const;
         int getNumVertices() const;
         int getNumEdges() const;
+        Weight getWeight(size_t u, size_t v) const;
+        Weight getMaxWeight() const;
+
+        // Check if any edge has a negative weight
+        bool hasNegativeWeights() const;
+
+        // Check if the adjacency matrix is symmetric (an undirected graph)
+        bool isSymmetric() const;
+
+        // Insert the edge u->v (or change its weight). O(1), keeps the connectivity tracker up to date.
+        void addEdge(size_t u, size_t v, Weight weight);
+
+        // Insert a batch of edges. Every edge is validated before any of them is applied.
+        void addEdges(const std::vector<BasicEdge<Weight>>& edges);
+
+        // Remove the edge u->v. O(1), throws if there is no such edge.
+        void removeEdge(size_t u, size_t v);
+
+        // Change the weight of the existing edge u->v. O(1).
+        void setWeight(size_t u, size_t v, Weight weight);
+
+        // Append an isolated vertex and return its id. Amortized O(V).
+        size_t addVertex();
+
+        // Remove vertex v and its edges in O(V). The last vertex takes over id v.
+        void removeVertex(size_t v);
+
+        // Components and bipartiteness of the graph with edge directions ignored. Built by one scan on
+        // first use, then maintained by addEdge so queries between insertions are O(1).
+        const IncrementalConnectivity& connectivity() const;
 
         // Check if there is an edge between two vertices
         bool isEdge(std::vector<std::vector<int>>::size_type u, std::vector<std::vector<int>>::size_type v) const;
 
         // Operator +
-        Graph operator+(const Graph& other) const;
+        BasicGraph operator+(const BasicGraph& other) const;
 
         // Operator -
-        Graph operator-(const Graph& other) const;
+        BasicGraph operator-(const BasicGraph& other) const;
 
         // Operator +=
-        Graph& operator+=(const Graph& other);
+        BasicGraph& operator+=(const BasicGraph& other);
 
         // Operator -=
-        Graph& operator-=(const Graph& other);
+        BasicGraph& operator-=(const BasicGraph& other);
 
         // Unary Operator -
-        Graph operator-() const;
+        BasicGraph operator-() const;
 
         // Operator ++
-        Graph& operator++();
+        BasicGraph& operator++();
 
         // Operator --
-        Graph& operator--();
+        BasicGraph& operator--();
 
         // Operator *
-        Graph& operator*(int scalar);
+        BasicGraph& operator*(Weight scalar);
 
         // Operator *
-        Graph operator*(const Graph& other) const;
+        BasicGraph operator*(const BasicGraph& other) const;
 
         // Operator <
-        bool operator<(const Graph& other) const;
+        bool operator<(const BasicGraph& other) const;
 
         // Operator >
-        bool operator>(const Graph& other) const;
+        bool operator>(const BasicGraph& other) const;
 
         // Operator ==
-        bool operator==(const Graph& other) const;
+        bool operator==(const BasicGraph& other) const;
 
         // Operator !=
-        bool operator!=(const Graph& other) const;
+        bool operator!=(const BasicGraph& other) const;
         
         // Operator <=
-        bool operator<=(const Graph& other) const;
+        bool operator<=(const BasicGraph& other) const;
 
         // Operator >=
-        bool operator>=(const Graph& other) const;
+        bool operator>=(const BasicGraph& other) const;
 
         // Visual representation of the graph
         void visualGraph() const;
     };
 
+    // The graph type used throughout the library
+    typedef BasicGraph<int> Graph;
+
 } // namespace ariel
 
 #endif /* GRAPH_HPP */
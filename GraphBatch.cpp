@@ -0,0 +1,268 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "GraphBatch.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace ariel {
+
+    namespace {
+        // Distance of vertices Bellman-Ford hasn't reached
+        const double UNREACHED = std::numeric_limits<double>::infinity();
+    }
+
+    const size_t GraphBatch::LANES;
+
+    // Constructor
+    GraphBatch::GraphBatch(size_t numVertices, size_t numGraphs)
+        : numVertices(numVertices), numGraphs(numGraphs), stride((numGraphs + LANES - 1) / LANES * LANES),
+          weights(numVertices * numVertices * stride, 0) {
+        if (numVertices == 0) {
+            throw std::invalid_argument("Invalid graph: The graph has no vertices.");
+        }
+    }
+
+    size_t GraphBatch::getNumVertices() const {
+        return numVertices;
+    }
+
+    size_t GraphBatch::getNumGraphs() const {
+        return numGraphs;
+    }
+
+    void GraphBatch::checkCell(size_t g, size_t u, size_t v) const {
+        if (g >= numGraphs) {
+            throw std::invalid_argument("Invalid graph index.");
+        }
+        if (u >= numVertices || v >= numVertices) {
+            throw std::invalid_argument("Invalid edge: Vertex out of range.");
+        }
+    }
+
+    void GraphBatch::setGraph(size_t g, const Graph& graph) {
+        if (static_cast<size_t>(graph.getNumVertices()) != numVertices) {
+            throw std::invalid_argument("Invalid graph: The vertex count doesn't match the batch.");
+        }
+        checkCell(g, 0, 0);
+        for (size_t u = 0; u < numVertices; ++u) {
+            for (size_t v = 0; v < numVertices; ++v) {
+                weights[(u * numVertices + v) * stride + g] = graph.getWeight(u, v);
+            }
+        }
+    }
+
+    Graph GraphBatch::getGraph(size_t g) const {
+        checkCell(g, 0, 0);
+        std::vector<std::vector<int>> matrix(numVertices, std::vector<int>(numVertices, 0));
+        for (size_t u = 0; u < numVertices; ++u) {
+            for (size_t v = 0; v < numVertices; ++v) {
+                matrix[u][v] = weights[(u * numVertices + v) * stride + g];
+            }
+        }
+        Graph graph;
+        graph.loadGraph(matrix);
+        return graph;
+    }
+
+    void GraphBatch::setWeight(size_t g, size_t u, size_t v, int weight) {
+        checkCell(g, u, v);
+        if (u == v && weight != 0) {
+            throw std::invalid_argument("Invalid edge: Self-loops are not allowed.");
+        }
+        weights[(u * numVertices + v) * stride + g] = weight;
+    }
+
+    int GraphBatch::getWeight(size_t g, size_t u, size_t v) const {
+        checkCell(g, u, v);
+        return weights[(u * numVertices + v) * stride + g];
+    }
+
+    const int* GraphBatch::lanes(size_t u, size_t v, size_t first) const {
+        return &weights[(u * numVertices + v) * stride + first];
+    }
+
+    std::vector<unsigned char> GraphBatch::forEachGroup(unsigned numThreads, void (GraphBatch::*kernel)(size_t, unsigned char*) const) const {
+        std::vector<unsigned char> results(stride, 0);
+        parallelFor(stride / LANES, numThreads, [&](size_t group) {
+            (this->*kernel)(group * LANES, &results[group * LANES]);
+        });
+        results.resize(numGraphs);
+        return results;
+    }
+
+    std::vector<unsigned char> GraphBatch::isConnected(unsigned numThreads) const {
+        return forEachGroup(numThreads, &GraphBatch::connectedGroup);
+    }
+
+    std::vector<unsigned char> GraphBatch::isBipartite(unsigned numThreads) const {
+        return forEachGroup(numThreads, &GraphBatch::bipartiteGroup);
+    }
+
+    std::vector<unsigned char> GraphBatch::negativeCycle(unsigned numThreads) const {
+        return forEachGroup(numThreads, &GraphBatch::negativeCycleGroup);
+    }
+
+    void GraphBatch::connectedGroup(size_t first, unsigned char* results) const {
+        // Reachability from vertex 0, swept over the rows in order until nothing changes
+        const size_t V = numVertices;
+        std::vector<unsigned char> reached(V * LANES, 0);
+        for (size_t l = 0; l < LANES; ++l) {
+            reached[l] = 1;
+        }
+        unsigned char changed = 1;
+        while (changed) {
+            changed = 0;
+            for (size_t u = 0; u < V; ++u) {
+                // A local copy of the row tells the compiler it can't alias the rows being updated
+                unsigned char from[LANES];
+                std::copy(&reached[u * LANES], &reached[u * LANES] + LANES, from);
+                for (size_t v = 0; v < V; ++v) {
+                    const int* w = lanes(u, v, first);
+                    unsigned char* to = &reached[v * LANES];
+                    unsigned char now[LANES];
+                    for (size_t l = 0; l < LANES; ++l) {
+                        now[l] = to[l] | (from[l] & (w[l] != 0));
+                        changed |= now[l] ^ to[l];
+                    }
+                    std::copy(now, now + LANES, to);
+                }
+            }
+        }
+        for (size_t l = 0; l < LANES; ++l) {
+            results[l] = 1;
+        }
+        for (size_t v = 0; v < V; ++v) {
+            for (size_t l = 0; l < LANES; ++l) {
+                results[l] &= reached[v * LANES + l];
+            }
+        }
+    }
+
+    void GraphBatch::bipartiteGroup(size_t first, unsigned char* results) const {
+        // Algorithms::isBipartite colors by BFS from every uncolored vertex in turn, so a vertex's
+        // color is the parity of its BFS level in the first tree that reaches it. Grow those trees
+        // level by level in all the lanes at once, then look for an edge inside one color.
+        const size_t V = numVertices;
+        std::vector<unsigned char> color(V * LANES, 0); // 0 uncolored, 1 side A, 2 side B
+        std::vector<unsigned char> frontier(V * LANES, 0);
+        std::vector<unsigned char> next(V * LANES, 0);
+        for (size_t root = 0; root < V; ++root) {
+            unsigned char* rootColor = &color[root * LANES];
+            unsigned char* rootFrontier = &frontier[root * LANES];
+            unsigned char any = 0;
+            for (size_t l = 0; l < LANES; ++l) {
+                rootFrontier[l] = rootColor[l] == 0;
+                rootColor[l] = rootColor[l] == 0 ? 1 : rootColor[l];
+                any |= rootFrontier[l];
+            }
+            for (unsigned char levelColor = 2; any; levelColor = static_cast<unsigned char>(3 - levelColor)) {
+                std::fill(next.begin(), next.end(), 0);
+                for (size_t u = 0; u < V; ++u) {
+                    const unsigned char* from = &frontier[u * LANES];
+                    unsigned char active = 0;
+                    for (size_t l = 0; l < LANES; ++l) {
+                        active |= from[l];
+                    }
+                    if (!active) {
+                        continue;
+                    }
+                    for (size_t v = 0; v < V; ++v) {
+                        const int* w = lanes(u, v, first);
+                        unsigned char* to = &next[v * LANES];
+                        for (size_t l = 0; l < LANES; ++l) {
+                            to[l] |= from[l] & (w[l] != 0);
+                        }
+                    }
+                }
+                any = 0;
+                for (size_t i = 0; i < V * LANES; ++i) {
+                    next[i] &= color[i] == 0;
+                    color[i] = next[i] ? levelColor : color[i];
+                    any |= next[i];
+                }
+                frontier.swap(next);
+            }
+            std::fill(frontier.begin(), frontier.end(), 0);
+        }
+
+        // Bipartite: no edge joins two vertices of one color, and side B isn't empty
+        std::vector<unsigned char> conflict(LANES, 0);
+        std::vector<unsigned char> hasB(LANES, 0);
+        for (size_t u = 0; u < V; ++u) {
+            const unsigned char* colorU = &color[u * LANES];
+            for (size_t l = 0; l < LANES; ++l) {
+                hasB[l] |= colorU[l] == 2;
+            }
+            for (size_t v = 0; v < V; ++v) {
+                const int* w = lanes(u, v, first);
+                const unsigned char* colorV = &color[v * LANES];
+                for (size_t l = 0; l < LANES; ++l) {
+                    conflict[l] |= (w[l] != 0) & (colorU[l] == colorV[l]);
+                }
+            }
+        }
+        for (size_t l = 0; l < LANES; ++l) {
+            results[l] = !conflict[l] && hasB[l];
+        }
+    }
+
+    void GraphBatch::negativeCycleGroup(size_t first, unsigned char* results) const {
+        // Bellman-Ford from vertex 0 in every lane, stopping early once a round changes nothing.
+        // Distances are doubles: sums of fewer than 2^21 int weights are exact, and with a missing
+        // edge costing infinity every relaxation is a branch-free add and min, which (unlike 64-bit
+        // integer compares) vectorizes with baseline SSE2.
+        const size_t V = numVertices;
+        std::vector<double> cost(V * V * LANES);
+        for (size_t cell = 0; cell < V * V; ++cell) {
+            const int* w = lanes(cell / V, cell % V, first);
+            for (size_t l = 0; l < LANES; ++l) {
+                cost[cell * LANES + l] = w[l] != 0 ? w[l] : UNREACHED;
+            }
+        }
+        std::vector<double> dist(V * LANES, UNREACHED);
+        std::vector<double> previous;
+        for (size_t l = 0; l < LANES; ++l) {
+            dist[l] = 0;
+        }
+        for (size_t round = 0; round + 1 < V; ++round) {
+            previous = dist;
+            for (size_t u = 0; u < V; ++u) {
+                double from[LANES];
+                std::copy(&dist[u * LANES], &dist[u * LANES] + LANES, from);
+                for (size_t v = 0; v < V; ++v) {
+                    const double* edge = &cost[(u * V + v) * LANES];
+                    double* to = &dist[v * LANES];
+                    double relaxed[LANES];
+                    for (size_t l = 0; l < LANES; ++l) {
+                        relaxed[l] = std::min(from[l] + edge[l], to[l]);
+                    }
+                    std::copy(relaxed, relaxed + LANES, to);
+                }
+            }
+            if (dist == previous) {
+                break;
+            }
+        }
+
+        // Any edge that still relaxes lies on or behind a negative cycle
+        for (size_t l = 0; l < LANES; ++l) {
+            results[l] = 0;
+        }
+        for (size_t u = 0; u < V; ++u) {
+            const double* from = &dist[u * LANES];
+            for (size_t v = 0; v < V; ++v) {
+                const double* edge = &cost[(u * V + v) * LANES];
+                const double* to = &dist[v * LANES];
+                for (size_t l = 0; l < LANES; ++l) {
+                    results[l] |= from[l] + edge[l] < to[l];
+                }
+            }
+        }
+    }
+
+} // namespace ariel
@@ -0,0 +1,69 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef GRAPHBATCH_HPP
+#define GRAPHBATCH_HPP
+
+#include "Graph.hpp"
+#include <vector>
+
+namespace ariel {
+
+    // Many graphs with the same vertex count, stored structure-of-arrays: the weights of edge u->v of
+    // every graph are contiguous, so one pass over a matrix cell updates a whole run of graphs and the
+    // inner loops vectorize across graphs. The batched queries take the graphs LANES at a time,
+    // handing the groups out to worker threads, and answer without building any strings.
+    class GraphBatch {
+    public:
+        // Graphs processed together by one worker; the storage is padded to a multiple of it
+        static const size_t LANES = 64;
+
+        // Constructor - numGraphs graphs of numVertices vertices, no edges
+        GraphBatch(size_t numVertices, size_t numGraphs);
+
+        size_t getNumVertices() const;
+        size_t getNumGraphs() const;
+
+        // Copy graph into slot g, throws if its vertex count differs
+        void setGraph(size_t g, const Graph& graph);
+
+        // Graph in slot g
+        Graph getGraph(size_t g) const;
+
+        // Weight of u->v in graph g, 0 removes the edge
+        void setWeight(size_t g, size_t u, size_t v, int weight);
+        int getWeight(size_t g, size_t u, size_t v) const;
+
+        // Batched Algorithms queries: entry g is 1 when the answer for graph g is yes.
+        // Each matches the corresponding Algorithms query on getGraph(g). numThreads = 0 uses every
+        // hardware thread.
+        std::vector<unsigned char> isConnected(unsigned numThreads = 0) const;
+        std::vector<unsigned char> isBipartite(unsigned numThreads = 0) const;
+        std::vector<unsigned char> negativeCycle(unsigned numThreads = 0) const;
+
+    private:
+        size_t numVertices;
+        size_t numGraphs;
+        size_t stride;            // numGraphs rounded up to a multiple of LANES
+        std::vector<int> weights; // weights[(u * numVertices + v) * stride + g]
+
+        // Helper method to get the weights of u->v in the LANES graphs starting at first
+        const int* lanes(size_t u, size_t v, size_t first) const;
+
+        // Helper method to check the arguments of setWeight and getWeight
+        void checkCell(size_t g, size_t u, size_t v) const;
+
+        // Per group kernels, writing results[first .. first + LANES)
+        void connectedGroup(size_t first, unsigned char* results) const;
+        void bipartiteGroup(size_t first, unsigned char* results) const;
+        void negativeCycleGroup(size_t first, unsigned char* results) const;
+
+        // Helper method to run kernel over every group
+        std::vector<unsigned char> forEachGroup(unsigned numThreads, void (GraphBatch::*kernel)(size_t, unsigned char*) const) const;
+    };
+
+} // namespace ariel
+
+#endif // GRAPHBATCH_HPP
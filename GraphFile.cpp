@@ -0,0 +1,178 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "GraphFile.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ariel {
+
+    static_assert(sizeof(GraphFileHeader) == 128, "The graph file header must stay 128 bytes");
+
+    const uint32_t GraphFileHeader::VERSION;
+    const uint32_t GraphFileHeader::ENDIAN_MARK;
+
+    static_assert(sizeof(GraphSnapshotHeader) == 80, "The snapshot header must stay 80 bytes");
+
+    const uint32_t GraphSnapshotHeader::VERSION;
+    const uint32_t GraphSnapshotHeader::SPARSE;
+    const uint32_t GraphSnapshotHeader::SYMMETRIC;
+
+    template <> uint32_t graphFileWeightCode<int8_t>() { return 1; }
+    template <> uint32_t graphFileWeightCode<int16_t>() { return 2; }
+    template <> uint32_t graphFileWeightCode<int32_t>() { return 3; }
+    template <> uint32_t graphFileWeightCode<int64_t>() { return 4; }
+    template <> uint32_t graphFileWeightCode<float>() { return 5; }
+    template <> uint32_t graphFileWeightCode<double>() { return 6; }
+
+    namespace {
+        // Check that count elements of size bytes at position pos lie inside a file of length bytes
+        bool fits(uint64_t pos, uint64_t count, uint64_t size, uint64_t length) {
+            return pos % 64 == 0 && pos <= length && count <= (length - pos) / size;
+        }
+    }
+
+    // Constructor
+    template <typename Weight>
+    MappedGraph<Weight>::MappedGraph() : base(nullptr), length(0), head(nullptr), offsets(nullptr), targetIds(nullptr), weights(nullptr) {}
+
+    // Destructor
+    template <typename Weight>
+    MappedGraph<Weight>::~MappedGraph() {
+        if (base != nullptr) {
+            munmap(const_cast<void*>(base), length);
+        }
+    }
+
+    template <typename Weight>
+    std::shared_ptr<const MappedGraph<Weight>> MappedGraph<Weight>::open(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::invalid_argument("Invalid graph file: Can't open " + path + ".");
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0 || static_cast<uint64_t>(info.st_size) < sizeof(GraphFileHeader)) {
+            close(fd);
+            throw std::invalid_argument("Invalid graph file: " + path + " is too short.");
+        }
+        auto length = static_cast<size_t>(info.st_size);
+        void* base = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd); // The mapping keeps the file alive
+        if (base == MAP_FAILED) {
+            throw std::invalid_argument("Invalid graph file: Can't map " + path + ".");
+        }
+
+        std::shared_ptr<MappedGraph> mapped(new MappedGraph());
+        mapped->base = base;
+        mapped->length = length;
+        const auto* head = static_cast<const GraphFileHeader*>(base);
+        mapped->head = head;
+
+        if (std::memcmp(head->magic, "ARIELGR", 8) != 0 || head->version != GraphFileHeader::VERSION ||
+            head->byteOrder != GraphFileHeader::ENDIAN_MARK || head->fileBytes != length) {
+            throw std::invalid_argument("Invalid graph file: " + path + " isn't a graph file of this version.");
+        }
+        if (head->weightCode != graphFileWeightCode<Weight>()) {
+            throw std::invalid_argument("Invalid graph file: The weight type doesn't match the graph.");
+        }
+        const uint64_t V = head->numVertices;
+        const auto* bytes = static_cast<const unsigned char*>(base);
+        if (head->layout == static_cast<uint32_t>(GraphFileLayout::Dense)) {
+            // 2^28 vertices keep V * V * sizeof(Weight) from wrapping around
+            if (V == 0 || V > (uint64_t(1) << 28) || !fits(head->valuesPos, V * V, sizeof(Weight), length)) {
+                throw std::invalid_argument("Invalid graph file: The dense payload is truncated.");
+            }
+            mapped->weights = reinterpret_cast<const Weight*>(bytes + head->valuesPos);
+        } else if (head->layout == static_cast<uint32_t>(GraphFileLayout::CSR)) {
+            if (V == 0 || V >= (uint64_t(1) << 32) || !fits(head->offsetsPos, V + 1, sizeof(uint64_t), length)) {
+                throw std::invalid_argument("Invalid graph file: The CSR payload is truncated.");
+            }
+            mapped->offsets = reinterpret_cast<const uint64_t*>(bytes + head->offsetsPos);
+            uint64_t E = mapped->offsets[V];
+            if (E != head->numEdges || !fits(head->targetsPos, E, sizeof(uint32_t), length) || !fits(head->valuesPos, E, sizeof(Weight), length)) {
+                throw std::invalid_argument("Invalid graph file: The CSR payload is truncated.");
+            }
+            mapped->targetIds = reinterpret_cast<const uint32_t*>(bytes + head->targetsPos);
+            mapped->weights = reinterpret_cast<const Weight*>(bytes + head->valuesPos);
+
+            // Rows must be in range and sorted, or weight() and CSR copies would read outside the file.
+            // One sequential O(V + E) pass, still far below the V^2 cells of a dense load.
+            if (mapped->offsets[0] != 0) {
+                throw std::invalid_argument("Invalid graph file: The CSR offsets are malformed.");
+            }
+            for (uint64_t u = 0; u < V; ++u) {
+                uint64_t begin = mapped->offsets[u];
+                uint64_t end = mapped->offsets[u + 1];
+                if (end < begin || end > E) {
+                    throw std::invalid_argument("Invalid graph file: The CSR offsets are malformed.");
+                }
+                for (uint64_t e = begin; e < end; ++e) {
+                    uint32_t target = mapped->targetIds[e];
+                    if (target >= V || target == u || (e > begin && target <= mapped->targetIds[e - 1])) {
+                        throw std::invalid_argument("Invalid graph file: The CSR targets are malformed.");
+                    }
+                }
+            }
+        } else {
+            throw std::invalid_argument("Invalid graph file: Unknown layout.");
+        }
+        return mapped;
+    }
+
+    template <typename Weight>
+    const GraphFileHeader& MappedGraph<Weight>::header() const {
+        return *head;
+    }
+
+    template <typename Weight>
+    GraphFileLayout MappedGraph<Weight>::layout() const {
+        return static_cast<GraphFileLayout>(head->layout);
+    }
+
+    template <typename Weight>
+    size_t MappedGraph<Weight>::getNumVertices() const {
+        return static_cast<size_t>(head->numVertices);
+    }
+
+    template <typename Weight>
+    Weight MappedGraph<Weight>::weight(size_t u, size_t v) const {
+        if (offsets == nullptr) {
+            return weights[u * static_cast<size_t>(head->numVertices) + v];
+        }
+        const uint32_t* first = targetIds + offsets[u];
+        const uint32_t* last = targetIds + offsets[u + 1];
+        const uint32_t* found = std::lower_bound(first, last, static_cast<uint32_t>(v));
+        return found != last && *found == v ? weights[found - targetIds] : Weight(0);
+    }
+
+    template <typename Weight>
+    uint64_t MappedGraph<Weight>::rowBegin(size_t u) const {
+        return offsets[u];
+    }
+
+    template <typename Weight>
+    const uint32_t* MappedGraph<Weight>::targets() const {
+        return targetIds;
+    }
+
+    template <typename Weight>
+    const Weight* MappedGraph<Weight>::values() const {
+        return weights;
+    }
+
+    // The weight types the library is built for
+    template class MappedGraph<int8_t>;
+    template class MappedGraph<int16_t>;
+    template class MappedGraph<int32_t>;
+    template class MappedGraph<int64_t>;
+    template class MappedGraph<float>;
+    template class MappedGraph<double>;
+
+} // namespace ariel
@@ -0,0 +1,123 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef GRAPHFILE_HPP
+#define GRAPHFILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ariel {
+
+    // Payload of a graph file: the dense V x V matrix, or CSR rows with sorted targets. Auto picks
+    // whichever is smaller.
+    enum class GraphFileLayout : uint32_t { Dense = 0, CSR = 1, Auto = 2 };
+
+    // Fixed 128-byte header at the start of a graph file. Every array of the payload starts on a
+    // 64-byte boundary and is stored in native byte order (checked through byteOrder).
+    //   Dense: values = V * V weights, row by row
+    //   CSR:   offsets = V + 1 uint64, targets = E uint32, values = E weights
+    // The edge statistics Graph keeps are stored too, so mapping a file doesn't rescan it.
+    struct GraphFileHeader {
+        char magic[8];           // "ARIELGR"
+        uint32_t version;        // GraphFileHeader::VERSION
+        uint32_t byteOrder;      // 0x01020304 as written
+        uint32_t layout;         // GraphFileLayout::Dense or GraphFileLayout::CSR
+        uint32_t weightCode;     // Weight type, see graphFileWeightCode
+        uint64_t numVertices;
+        uint64_t numEdges;
+        int64_t numNegativeEdges;
+        int64_t numAsymmetricPairs;
+        int64_t numMaxWeightEdges;
+        unsigned char maxWeight[8]; // Bytes of the Weight maximum
+        uint64_t offsetsPos;     // Byte positions of the arrays, 0 when absent
+        uint64_t targetsPos;
+        uint64_t valuesPos;
+        uint64_t fileBytes;
+        unsigned char reserved[24];
+
+        static const uint32_t VERSION = 1;
+        static const uint32_t ENDIAN_MARK = 0x01020304;
+    };
+
+    // Header of a graph snapshot (BasicGraph::saveSnapshot), a compact stream format for save/restore.
+    // The payload follows directly and holds the cells of the storage in order (Full: row by row,
+    // Symmetric: the packed triangle column by column), either
+    //   dense:  every cell as a raw weight
+    //   sparse: per row (or column) a varint count, then for each nonzero cell a varint gap to the
+    //           previous nonzero (the first counts from -1) and its weight, a zigzag varint for
+    //           integer weights or the raw bytes for floating point ones
+    struct GraphSnapshotHeader {
+        char magic[8];           // "ARIELSN"
+        uint32_t version;        // GraphSnapshotHeader::VERSION
+        uint32_t byteOrder;      // GraphFileHeader::ENDIAN_MARK as written
+        uint32_t weightCode;     // Weight type, see graphFileWeightCode
+        uint32_t flags;          // SPARSE, SYMMETRIC
+        uint64_t numVertices;
+        int64_t numEdges;
+        int64_t numNegativeEdges;
+        int64_t numAsymmetricPairs;
+        int64_t numMaxWeightEdges;
+        unsigned char maxWeight[8]; // Bytes of the Weight maximum
+        uint64_t payloadBytes;
+
+        static const uint32_t VERSION = 1;
+        static const uint32_t SPARSE = 1;    // Varint payload
+        static const uint32_t SYMMETRIC = 2; // Symmetric storage
+    };
+
+    // Code a Weight type is stored under
+    template <typename Weight>
+    uint32_t graphFileWeightCode();
+    template <> uint32_t graphFileWeightCode<int8_t>();
+    template <> uint32_t graphFileWeightCode<int16_t>();
+    template <> uint32_t graphFileWeightCode<int32_t>();
+    template <> uint32_t graphFileWeightCode<int64_t>();
+    template <> uint32_t graphFileWeightCode<float>();
+    template <> uint32_t graphFileWeightCode<double>();
+
+    // Read-only memory mapping of a graph file. Opening a Dense file validates the header and the
+    // array bounds only, so it takes O(1) time whatever the size; a CSR file also gets one O(V + E)
+    // pass checking that offsets are non-decreasing and targets sorted and in range. Pages are read
+    // on first touch and shared through the page cache by every process mapping the same file.
+    template <typename Weight>
+    class MappedGraph {
+    public:
+        // Map the file at path, throws if it isn't a valid graph file of Weight
+        static std::shared_ptr<const MappedGraph> open(const std::string& path);
+
+        // Destructor - unmaps the file
+        ~MappedGraph();
+
+        const GraphFileHeader& header() const;
+        GraphFileLayout layout() const;
+        size_t getNumVertices() const;
+
+        // Weight of u->v, 0 if there is none. O(1) for Dense, a binary search of row u for CSR.
+        Weight weight(size_t u, size_t v) const;
+
+        // Row u of a CSR file: targets and values in [rowBegin(u), rowBegin(u + 1))
+        uint64_t rowBegin(size_t u) const;
+        const uint32_t* targets() const;
+        const Weight* values() const;
+
+    private:
+        const void* base;
+        size_t length;
+        const GraphFileHeader* head;
+        const uint64_t* offsets;
+        const uint32_t* targetIds;
+        const Weight* weights;
+
+        MappedGraph();
+        MappedGraph(const MappedGraph&);
+        MappedGraph& operator=(const MappedGraph&);
+    };
+
+} // namespace ariel
+
+#endif // GRAPHFILE_HPP
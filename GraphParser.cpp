@@ -0,0 +1,436 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "GraphParser.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace ariel {
+
+    const size_t GraphParser::CHUNK_BYTES;
+
+    double ParseReport::megabytesPerSecond() const {
+        return seconds > 0 ? static_cast<double>(bytes) / 1e6 / seconds : 0;
+    }
+
+    namespace {
+        inline bool isBlank(char c) {
+            return c == ' ' || c == '\t' || c == '\r';
+        }
+
+        inline void skipBlanks(const char*& p, const char* end) {
+            while (p < end && isBlank(*p)) {
+                ++p;
+            }
+        }
+
+        // Parse an optionally signed decimal integer at p (after blanks), no locale and no allocation.
+        // Returns false if there is none or it doesn't fit in a long long.
+        inline bool parseInteger(const char*& p, const char* end, long long& value) {
+            skipBlanks(p, end);
+            bool negative = false;
+            if (p < end && (*p == '-' || *p == '+')) {
+                negative = *p == '-';
+                ++p;
+            }
+            if (p == end || *p < '0' || *p > '9') {
+                return false;
+            }
+            long long result = 0;
+            while (p < end && *p >= '0' && *p <= '9') {
+                if (result > (LLONG_MAX - 9) / 10) {
+                    return false;
+                }
+                result = result * 10 + (*p++ - '0');
+            }
+            if (p < end && !isBlank(*p)) {
+                return false; // "12abc"
+            }
+            value = negative ? -result : result;
+            return true;
+        }
+
+        // Nothing but blanks left on the line
+        inline bool atLineEnd(const char* p, const char* end) {
+            skipBlanks(p, end);
+            return p == end;
+        }
+
+        // Edges parsed from one piece of a chunk, or the first line that failed
+        struct Piece {
+            const char* begin;
+            const char* end;
+            std::vector<Edge> edges;
+            std::string error;
+        };
+
+        // Everything learned so far about the input
+        struct ParseState {
+            GraphTextFormat format;
+            bool headerDone;     // Banner, size or problem line consumed
+            size_t numVertices;  // Known once the header is done (EdgeList: at the end)
+            long long declared;  // Entries announced by the header, -1 for EdgeList
+            bool symmetric;      // Matrix Market "symmetric"
+            bool pattern;        // Matrix Market "pattern": no values, every weight is 1
+            size_t entries;
+            size_t maxId;
+            std::vector<std::vector<int>> rows; // Full storage being built
+            std::vector<int> upper;             // Symmetric storage being built
+            bool buffering;                     // EdgeList from a stream that can't rewind: edges kept in pending
+            std::vector<Edge> pending;          // Buffered EdgeList edges, placed once the vertex count is known
+        };
+
+        std::string badLine(const char* begin, const char* end) {
+            std::string line(begin, static_cast<size_t>(std::min<std::ptrdiff_t>(end - begin, 60)));
+            return "Invalid graph file: Can't parse line \"" + line + "\".";
+        }
+
+        // Lowercase copy of the next word on the line
+        std::string nextWord(const char*& p, const char* end) {
+            skipBlanks(p, end);
+            std::string word;
+            while (p < end && !isBlank(*p)) {
+                word += static_cast<char>(*p >= 'A' && *p <= 'Z' ? *p - 'A' + 'a' : *p);
+                ++p;
+            }
+            return word;
+        }
+
+        // Helper method to allocate the storage once the vertex count is known
+        void allocate(ParseState& state, size_t numVertices) {
+            if (numVertices == 0) {
+                throw std::invalid_argument("Invalid graph: The graph is empty.");
+            }
+            state.numVertices = numVertices;
+            if (state.symmetric) {
+                state.upper.assign(numVertices * (numVertices - 1) / 2, 0);
+            } else {
+                state.rows.assign(numVertices, std::vector<int>(numVertices, 0));
+            }
+        }
+
+        // Consume one header line, returns false at the first data line
+        bool parseHeaderLine(ParseState& state, const char* p, const char* end) {
+            const char* line = p;
+            skipBlanks(p, end);
+            if (state.format == GraphTextFormat::Dimacs) {
+                if (p == end || *p == 'c') {
+                    return true;
+                }
+                if (*p != 'p') {
+                    if (state.numVertices == 0) {
+                        throw std::invalid_argument("Invalid graph file: The DIMACS problem line is missing.");
+                    }
+                    state.headerDone = true;
+                    return false;
+                }
+                ++p;
+                long long V = 0;
+                long long E = 0;
+                if (state.numVertices != 0 || nextWord(p, end) != "sp" || !parseInteger(p, end, V) ||
+                    !parseInteger(p, end, E) || !atLineEnd(p, end) || V <= 0 || E < 0) {
+                    throw std::invalid_argument(badLine(line, end));
+                }
+                state.declared = E;
+                allocate(state, static_cast<size_t>(V));
+                return true;
+            }
+
+            // Matrix Market: banner, comments, then the size line
+            if (state.declared == -2) {
+                if (nextWord(p, end) != "%%matrixmarket" || nextWord(p, end) != "matrix" ||
+                    nextWord(p, end) != "coordinate") {
+                    throw std::invalid_argument("Invalid graph file: Expected a coordinate Matrix Market banner.");
+                }
+                std::string field = nextWord(p, end);
+                std::string symmetry = nextWord(p, end);
+                if ((field != "integer" && field != "pattern") || (symmetry != "general" && symmetry != "symmetric")) {
+                    throw std::invalid_argument("Invalid graph file: Only integer or pattern, general or symmetric matrices are supported.");
+                }
+                state.pattern = field == "pattern";
+                state.symmetric = symmetry == "symmetric";
+                state.declared = -1;
+                return true;
+            }
+            if (p == end || *p == '%') {
+                return true;
+            }
+            long long rows = 0;
+            long long cols = 0;
+            long long nnz = 0;
+            if (!parseInteger(p, end, rows) || !parseInteger(p, end, cols) || !parseInteger(p, end, nnz) ||
+                !atLineEnd(p, end) || rows <= 0 || nnz < 0) {
+                throw std::invalid_argument(badLine(line, end));
+            }
+            if (rows != cols) {
+                throw std::invalid_argument("Invalid graph: The graph is not a square matrix.");
+            }
+            state.declared = nnz;
+            allocate(state, static_cast<size_t>(rows));
+            state.headerDone = true;
+            return true;
+        }
+
+        // Parse the data lines of one piece. Runs on a worker thread, so errors are recorded, not thrown.
+        void parsePiece(GraphTextFormat format, bool pattern, Piece& piece) {
+            const char* p = piece.begin;
+            while (p < piece.end) {
+                const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(piece.end - p)));
+                if (lineEnd == nullptr) {
+                    lineEnd = piece.end;
+                }
+                const char* line = p;
+                const char* q = p;
+                p = lineEnd + 1;
+                skipBlanks(q, lineEnd);
+                if (q == lineEnd) {
+                    continue;
+                }
+                long long from = 0;
+                long long to = 0;
+                long long weight = 1;
+                long long base = 1;
+                if (format == GraphTextFormat::EdgeList) {
+                    if (*q == '#' || *q == '%') {
+                        continue;
+                    }
+                    base = 0;
+                    if (!parseInteger(q, lineEnd, from) || !parseInteger(q, lineEnd, to) ||
+                        (!atLineEnd(q, lineEnd) && !parseInteger(q, lineEnd, weight))) {
+                        piece.error = badLine(line, lineEnd);
+                        return;
+                    }
+                } else if (format == GraphTextFormat::Dimacs) {
+                    if (*q == 'c') {
+                        continue;
+                    }
+                    if (*q++ != 'a' || !parseInteger(q, lineEnd, from) || !parseInteger(q, lineEnd, to) ||
+                        !parseInteger(q, lineEnd, weight)) {
+                        piece.error = badLine(line, lineEnd);
+                        return;
+                    }
+                } else {
+                    if (*q == '%') {
+                        continue;
+                    }
+                    if (!parseInteger(q, lineEnd, from) || !parseInteger(q, lineEnd, to) ||
+                        (!pattern && !parseInteger(q, lineEnd, weight))) {
+                        piece.error = badLine(line, lineEnd);
+                        return;
+                    }
+                }
+                if (!atLineEnd(q, lineEnd) || from < base || to < base || weight < INT_MIN || weight > INT_MAX) {
+                    piece.error = badLine(line, lineEnd);
+                    return;
+                }
+                Edge edge = {static_cast<size_t>(from - base), static_cast<size_t>(to - base), static_cast<int>(weight)};
+                piece.edges.push_back(edge);
+            }
+        }
+
+        // Helper method to write one edge into the storage being built
+        void place(ParseState& state, const Edge& edge) {
+            if (edge.from >= state.numVertices || edge.to >= state.numVertices) {
+                throw std::invalid_argument("Invalid vertex: Vertex out of range.");
+            }
+            if (edge.from == edge.to) {
+                if (edge.weight != 0) {
+                    throw std::invalid_argument("Invalid graph: The graph contains non-zero diagonal elements.");
+                }
+                return;
+            }
+            if (state.symmetric) {
+                size_t u = std::min(edge.from, edge.to);
+                size_t v = std::max(edge.from, edge.to);
+                state.upper[v * (v - 1) / 2 + u] = edge.weight;
+            } else {
+                state.rows[edge.from][edge.to] = edge.weight;
+            }
+        }
+
+        // Parse the complete lines in [begin, end): header lines one by one, data lines in parallel
+        void parseBlock(ParseState& state, const char* begin, const char* end, unsigned numThreads) {
+            while (!state.headerDone && state.format != GraphTextFormat::EdgeList && begin < end) {
+                const char* lineEnd = static_cast<const char*>(std::memchr(begin, '\n', static_cast<size_t>(end - begin)));
+                if (lineEnd == nullptr) {
+                    lineEnd = end;
+                }
+                if (!parseHeaderLine(state, begin, lineEnd)) {
+                    break;
+                }
+                begin = lineEnd == end ? end : lineEnd + 1;
+            }
+            if (begin == end || (!state.headerDone && state.format != GraphTextFormat::EdgeList)) {
+                return;
+            }
+
+            // Cut the block into a few pieces per worker at line boundaries
+            unsigned workers = numThreads == 0 ? defaultThreadCount() : numThreads;
+            auto length = static_cast<size_t>(end - begin);
+            size_t numPieces = std::max<size_t>(1, std::min<size_t>(size_t(4) * workers, length / 4096));
+            std::vector<Piece> pieces;
+            const char* start = begin;
+            for (size_t i = 1; i <= numPieces && start < end; ++i) {
+                const char* cut = i == numPieces ? end : begin + length * i / numPieces;
+                if (cut < start) {
+                    continue;
+                }
+                const char* newline = static_cast<const char*>(std::memchr(cut, '\n', static_cast<size_t>(end - cut)));
+                cut = newline == nullptr ? end : newline + 1;
+                Piece piece;
+                piece.begin = start;
+                piece.end = cut;
+                pieces.push_back(piece);
+                start = cut;
+            }
+            GraphTextFormat format = state.format;
+            bool pattern = state.pattern;
+            parallelFor(pieces.size(), numThreads, [&](size_t i) {
+                parsePiece(format, pattern, pieces[i]);
+            });
+
+            // Apply in file order so a repeated edge keeps its last weight
+            for (Piece& piece : pieces) {
+                if (!piece.error.empty()) {
+                    throw std::invalid_argument(piece.error);
+                }
+                state.entries += piece.edges.size();
+                if (state.numVertices == 0) {
+                    // EdgeList before the vertex count is known: first pass over the input
+                    for (const Edge& edge : piece.edges) {
+                        state.maxId = std::max(state.maxId, std::max(edge.from, edge.to) + 1);
+                    }
+                    if (state.buffering) {
+                        state.pending.insert(state.pending.end(), piece.edges.begin(), piece.edges.end());
+                    }
+                } else {
+                    for (const Edge& edge : piece.edges) {
+                        place(state, edge);
+                    }
+                }
+            }
+        }
+
+        // Helper method to parse the whole stream chunk by chunk, returns the bytes read
+        size_t parseStream(ParseState& state, std::istream& in, unsigned numThreads) {
+            // Read a chunk, parse its complete lines and carry the partial last line over to the next one
+            size_t bytes = 0;
+            std::vector<char> buffer;
+            size_t carried = 0;
+            while (true) {
+                buffer.resize(carried + GraphParser::CHUNK_BYTES);
+                in.read(buffer.data() + carried, static_cast<std::streamsize>(GraphParser::CHUNK_BYTES));
+                auto got = static_cast<size_t>(in.gcount());
+                bytes += got;
+                size_t filled = carried + got;
+                bool last = got < GraphParser::CHUNK_BYTES;
+                const char* begin = buffer.data();
+                const char* end = begin + filled;
+                if (!last) {
+                    while (end > begin && end[-1] != '\n') {
+                        --end;
+                    }
+                    if (end == begin) {
+                        carried = filled; // A single line longer than the chunk
+                        continue;
+                    }
+                }
+                parseBlock(state, begin, end, numThreads);
+                if (last) {
+                    break;
+                }
+                carried = filled - static_cast<size_t>(end - begin);
+                std::memmove(buffer.data(), end, carried);
+            }
+            if (in.bad()) {
+                throw std::invalid_argument("Invalid graph file: Reading failed.");
+            }
+            return bytes;
+        }
+    }
+
+    ParseReport GraphParser::read(Graph& graph, std::istream& in, GraphTextFormat format, unsigned numThreads) {
+        auto start = std::chrono::steady_clock::now();
+        ParseState state;
+        state.format = format;
+        state.headerDone = false;
+        state.numVertices = 0;
+        state.declared = format == GraphTextFormat::MatrixMarket ? -2 : -1;
+        state.symmetric = false;
+        state.pattern = false;
+        state.entries = 0;
+        state.maxId = 0;
+
+        // An edge list only gives its vertex count at the end: a stream that can rewind is read twice,
+        // once for the largest id and once to place the edges, any other one has its edges buffered
+        std::streampos origin = format == GraphTextFormat::EdgeList ? in.tellg() : std::streampos(-1);
+        state.buffering = format == GraphTextFormat::EdgeList && origin == std::streampos(-1);
+
+        ParseReport report = {0, 0, 0};
+        report.bytes = parseStream(state, in, numThreads);
+        if (format == GraphTextFormat::EdgeList) {
+            allocate(state, state.maxId);
+            if (state.buffering) {
+                for (const Edge& edge : state.pending) {
+                    place(state, edge);
+                }
+            } else {
+                in.clear();
+                in.seekg(origin);
+                if (!in) {
+                    throw std::invalid_argument("Invalid graph file: Reading failed.");
+                }
+                state.entries = 0;
+                parseStream(state, in, numThreads);
+            }
+        } else if (state.numVertices == 0) {
+            throw std::invalid_argument(format == GraphTextFormat::Dimacs ? "Invalid graph file: The DIMACS problem line is missing."
+                                                                          : "Invalid graph file: The Matrix Market size line is missing.");
+        } else if (static_cast<long long>(state.entries) != state.declared) {
+            throw std::invalid_argument("Invalid graph file: The header announces " + std::to_string(state.declared) +
+                                        " entries, the file has " + std::to_string(state.entries) + ".");
+        }
+
+        // Hand the finished storage to the graph
+        graph.mapped.reset();
+        graph.graph.swap(state.rows);
+        graph.upper.swap(state.upper);
+        graph.storage = state.symmetric ? GraphStorage::Symmetric : GraphStorage::Full;
+        graph.numVertices = state.numVertices;
+        graph.refreshCachedState();
+
+        report.entries = state.entries;
+        report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return report;
+    }
+
+    ParseReport GraphParser::load(Graph& graph, const std::string& path, GraphTextFormat format, unsigned numThreads) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            throw std::invalid_argument("Invalid graph file: Can't open " + path + ".");
+        }
+        return read(graph, in, format, numThreads);
+    }
+
+    GraphTextFormat GraphParser::formatOf(const std::string& path) {
+        auto endsWith = [&](const std::string& suffix) {
+            return path.size() >= suffix.size() && path.compare(path.size() - suffix.size(), suffix.size(), suffix) == 0;
+        };
+        if (endsWith(".gr")) {
+            return GraphTextFormat::Dimacs;
+        }
+        if (endsWith(".mtx")) {
+            return GraphTextFormat::MatrixMarket;
+        }
+        return GraphTextFormat::EdgeList;
+    }
+
+} // namespace ariel
@@ -0,0 +1,53 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef GRAPHPARSER_HPP
+#define GRAPHPARSER_HPP
+
+#include "Graph.hpp"
+#include <istream>
+#include <string>
+
+namespace ariel {
+
+    // Text formats understood by GraphParser:
+    // EdgeList     - "u v [weight]" per line, 0-based ids, weight 1 when omitted, '#' and '%' start comments
+    // Dimacs       - 9th DIMACS challenge .gr: "c" comments, one "p sp V E" line, then "a u v weight" arcs (1-based)
+    // MatrixMarket - "%%MatrixMarket matrix coordinate integer|pattern general|symmetric", "n n nnz", then "i j [value]" (1-based)
+    enum class GraphTextFormat { EdgeList, Dimacs, MatrixMarket };
+
+    // What one load did
+    struct ParseReport {
+        size_t bytes;   // Bytes of text read
+        size_t entries; // Edge lines parsed
+        double seconds; // Wall time of the whole load
+        double megabytesPerSecond() const;
+    };
+
+    // Streaming loaders for large text graphs. The input is read CHUNK_BYTES at a time; every chunk is
+    // cut into pieces at line boundaries that are parsed in parallel by a locale-free integer scanner,
+    // and the edges are written straight into the new storage (no intermediate matrix). An edge list
+    // has no header, so it is read twice: a first pass finds the largest vertex id, the second places
+    // the edges. A stream that can't seek back (a pipe) is read once with its edges buffered until the
+    // end, which costs memory proportional to the number of edges. A Matrix Market file declared
+    // symmetric is built with Symmetric storage, every other input with Full storage.
+    // On error the graph is left unchanged.
+    class GraphParser {
+    public:
+        static const size_t CHUNK_BYTES = size_t(1) << 24;
+
+        // Replace graph by the graph in the file at path. numThreads = 0 uses every hardware thread.
+        static ParseReport load(Graph& graph, const std::string& path, GraphTextFormat format, unsigned numThreads = 0);
+
+        // Same, reading the text from a stream
+        static ParseReport read(Graph& graph, std::istream& in, GraphTextFormat format, unsigned numThreads = 0);
+
+        // Format guessed from the file extension: .gr is Dimacs, .mtx is MatrixMarket, anything else EdgeList
+        static GraphTextFormat formatOf(const std::string& path);
+    };
+
+} // namespace ariel
+
+#endif // GRAPHPARSER_HPP
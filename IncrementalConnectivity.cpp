@@ -0,0 +1,107 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "IncrementalConnectivity.hpp"
+
+namespace ariel {
+
+    // Constructor
+    IncrementalConnectivity::IncrementalConnectivity(size_t n)
+        : parent(n), rank(n, 0), parity(n, 0), numSets(n), bipartite(true) {
+        for (size_t i = 0; i < n; ++i) {
+            parent[i] = i;
+        }
+    }
+
+    size_t IncrementalConnectivity::root(size_t v, unsigned char& colorToRoot) const {
+        unsigned char pathParity = 0;
+        while (parent[v] != v) {
+            pathParity ^= parity[v];
+            v = parent[v];
+        }
+        colorToRoot = pathParity;
+        return v;
+    }
+
+    size_t IncrementalConnectivity::find(size_t v, unsigned char& colorToRoot) {
+        // First pass: find the root and the parity of the whole path
+        size_t root = this->root(v, colorToRoot);
+        unsigned char pathParity = colorToRoot;
+
+        // Second pass: hang every vertex on the path directly under the root
+        while (parent[v] != root) {
+            size_t next = parent[v];
+            unsigned char nextParity = pathParity ^ parity[v];
+            parent[v] = root;
+            parity[v] = pathParity;
+            v = next;
+            pathParity = nextParity;
+        }
+        return root;
+    }
+
+    void IncrementalConnectivity::addEdge(size_t u, size_t v) {
+        unsigned char colorU = 0;
+        unsigned char colorV = 0;
+        size_t rootU = find(u, colorU);
+        size_t rootV = find(v, colorV);
+        if (rootU == rootV) {
+            if (colorU == colorV) {
+                bipartite = false; // Odd cycle
+            }
+            return;
+        }
+
+        // Link the roots so that u and v end up on opposite sides
+        if (rank[rootU] < rank[rootV]) {
+            size_t tmp = rootU;
+            rootU = rootV;
+            rootV = tmp;
+        }
+        parent[rootV] = rootU;
+        parity[rootV] = static_cast<unsigned char>(colorU ^ colorV ^ 1);
+        if (rank[rootU] == rank[rootV]) {
+            rank[rootU]++;
+        }
+        numSets--;
+    }
+
+    size_t IncrementalConnectivity::addVertex() {
+        parent.push_back(parent.size());
+        rank.push_back(0);
+        parity.push_back(0);
+        numSets++;
+        return parent.size() - 1;
+    }
+
+    size_t IncrementalConnectivity::getNumVertices() const {
+        return parent.size();
+    }
+
+    size_t IncrementalConnectivity::componentCount() const {
+        return numSets;
+    }
+
+    bool IncrementalConnectivity::isConnected() const {
+        return numSets == 1;
+    }
+
+    bool IncrementalConnectivity::isBipartite() const {
+        return bipartite;
+    }
+
+    bool IncrementalConnectivity::connected(size_t u, size_t v) const {
+        unsigned char colorU = 0;
+        unsigned char colorV = 0;
+        return root(u, colorU) == root(v, colorV);
+    }
+
+    int IncrementalConnectivity::color(size_t v) const {
+        unsigned char colorV = 0;
+        root(v, colorV);
+        return colorV;
+    }
+
+} // namespace ariel
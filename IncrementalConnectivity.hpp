@@ -0,0 +1,59 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef INCREMENTALCONNECTIVITY_HPP
+#define INCREMENTALCONNECTIVITY_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace ariel {
+
+    // Components and bipartiteness of an undirected graph under edge insertions.
+    // A union-find with a parity bit per vertex (its color relative to its parent) absorbs each
+    // edge in amortized near-constant time; an edge between two same-colored vertices of one
+    // component closes an odd cycle, after which the graph can never become bipartite again.
+    // Queries don't compress paths (union by rank keeps them O(log n) long), so const calls may run
+    // from several threads at once.
+    class IncrementalConnectivity {
+    public:
+        // Constructor - n isolated vertices
+        explicit IncrementalConnectivity(size_t n);
+
+        // Insert the undirected edge u-v
+        void addEdge(size_t u, size_t v);
+
+        // Append an isolated vertex, returns its id
+        size_t addVertex();
+
+        // O(1) queries
+        size_t getNumVertices() const;
+        size_t componentCount() const;
+        bool isConnected() const;
+        bool isBipartite() const;
+
+        // Check if u and v are in the same component
+        bool connected(size_t u, size_t v) const;
+
+        // Side of v (0 or 1) in a 2-coloring of its component, meaningful while the graph is bipartite
+        int color(size_t v) const;
+
+    private:
+        std::vector<size_t> parent;
+        std::vector<unsigned char> rank;
+        std::vector<unsigned char> parity; // Color of the vertex XOR color of its parent
+        size_t numSets;
+        bool bipartite;
+
+        // Helper method to find the root of v and v's color relative to it, read-only
+        size_t root(size_t v, unsigned char& colorToRoot) const;
+
+        // Helper method to find the root of v and v's color relative to it, compressing the path
+        size_t find(size_t v, unsigned char& colorToRoot);
+    };
+
+} // namespace ariel
+
+#endif // INCREMENTALCONNECTIVITY_HPP
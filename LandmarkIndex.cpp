@@ -0,0 +1,205 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "LandmarkIndex.hpp"
+#include "Parallel.hpp"
+#include "ShortestPaths.hpp"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace ariel {
+
+    const long long LandmarkIndex::INF = std::numeric_limits<long long>::max() / 4; // Same as ShortestPaths::INF
+
+    // Constructor
+    LandmarkIndex::LandmarkIndex(const Graph& graph, size_t numLandmarks, unsigned numThreads) {
+        if (graph.hasNegativeWeights()) {
+            throw std::invalid_argument("Invalid graph: Landmark index requires non-negative weights.");
+        }
+
+        forward = CSRGraph::fromGraph(graph);
+        CSRGraph backward = CSRGraph::fromGraph(graph, true);
+        selectLandmarks(backward, numLandmarks);
+
+        size_t V = forward.numVertices;
+        size_t k = landmarks.size();
+        fromLandmark.assign(V * k, INF);
+        toLandmark.assign(V * k, INF);
+
+        // Searches 0..k-1 run forward from each landmark, k..2k-1 run on the transpose (distances to it)
+        std::vector<std::vector<long long>> searches(2 * k);
+        parallelFor(2 * k, numThreads, [&](size_t task) {
+            if (task < k) {
+                searches[task] = ShortestPaths::dijkstra(forward, landmarks[task]);
+            } else {
+                searches[task] = ShortestPaths::dijkstra(backward, landmarks[task - k]);
+            }
+        });
+
+        // Interleave per vertex so a heuristic evaluation touches one contiguous block
+        for (size_t i = 0; i < k; ++i) {
+            for (size_t v = 0; v < V; ++v) {
+                fromLandmark[v * k + i] = searches[i][v];
+                toLandmark[v * k + i] = searches[k + i][v];
+            }
+        }
+    }
+
+    const std::vector<size_t>& LandmarkIndex::getLandmarks() const {
+        return landmarks;
+    }
+
+    size_t LandmarkIndex::getNumVertices() const {
+        return forward.numVertices;
+    }
+
+    void LandmarkIndex::selectLandmarks(const CSRGraph& backward, size_t numLandmarks) {
+        size_t V = forward.numVertices;
+        size_t k = std::min(numLandmarks, V);
+        const size_t unreached = std::numeric_limits<size_t>::max();
+        std::vector<size_t> minHop(V, unreached);
+        std::vector<size_t> hop(V);
+        std::queue<size_t> q;
+        const CSRGraph* directions[] = {&forward, &backward};
+
+        // Hop distances from source over both edge directions
+        auto bfs = [&](size_t source) {
+            std::fill(hop.begin(), hop.end(), unreached);
+            hop[source] = 0;
+            q.push(source);
+            while (!q.empty()) {
+                size_t u = q.front();
+                q.pop();
+                for (const CSRGraph* csr : directions) {
+                    for (size_t e = csr->offsets[u]; e < csr->offsets[u + 1]; ++e) {
+                        size_t v = csr->targets[e];
+                        if (hop[v] == unreached) {
+                            hop[v] = hop[u] + 1;
+                            q.push(v);
+                        }
+                    }
+                }
+            }
+        };
+
+        // The first landmark is the vertex farthest from 0, unreached vertices count as farthest
+        size_t candidate = 0;
+        if (k > 0) {
+            bfs(0);
+            candidate = static_cast<size_t>(std::max_element(hop.begin(), hop.end()) - hop.begin());
+        }
+
+        while (landmarks.size() < k) {
+            landmarks.push_back(candidate);
+            bfs(candidate);
+            for (size_t v = 0; v < V; ++v) {
+                minHop[v] = std::min(minHop[v], hop[v]);
+            }
+
+            // Next landmark: the vertex farthest from every landmark chosen so far
+            candidate = static_cast<size_t>(std::max_element(minHop.begin(), minHop.end()) - minHop.begin());
+            if (minHop[candidate] == 0) {
+                break; // Every vertex is already a landmark
+            }
+        }
+    }
+
+    long long LandmarkIndex::lowerBound(size_t v, size_t target) const {
+        size_t k = landmarks.size();
+        const long long* fromV = fromLandmark.data() + v * k;
+        const long long* fromT = fromLandmark.data() + target * k;
+        const long long* toV = toLandmark.data() + v * k;
+        const long long* toT = toLandmark.data() + target * k;
+        long long bound = 0;
+
+        for (size_t i = 0; i < k; ++i) {
+            // dist(L, t) <= dist(L, v) + dist(v, t)
+            if (fromV[i] != INF) {
+                if (fromT[i] == INF) {
+                    return INF; // L reaches v but not t, so v can't reach t either
+                }
+                bound = std::max(bound, fromT[i] - fromV[i]);
+            }
+            // dist(v, L) <= dist(v, t) + dist(t, L)
+            if (toT[i] != INF) {
+                if (toV[i] == INF) {
+                    return INF; // t reaches L but v doesn't, so v can't reach t
+                }
+                bound = std::max(bound, toV[i] - toT[i]);
+            }
+        }
+        return bound;
+    }
+
+    size_t LandmarkIndex::query(size_t start, size_t end, std::vector<size_t>& path) const {
+        // (estimate, distance, vertex): on equal estimates the vertex nearer start goes first, so every
+        // predecessor of a vertex on a shortest path settles before it and the tie-break sees them all
+        typedef std::tuple<long long, long long, size_t> Entry;
+        size_t V = forward.numVertices;
+        const size_t none = ShortestPaths::NONE;
+        std::vector<long long> dist(V, INF);
+        std::vector<size_t> prev(V, none);
+        std::vector<size_t> sweep(V, 0);
+        std::vector<bool> settled(V, false);
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> pq;
+        size_t numSettled = 0;
+        path.clear();
+
+        if (lowerBound(start, end) == INF) {
+            return 0;
+        }
+        dist[start] = 0;
+        pq.push(Entry(lowerBound(start, end), 0, start));
+
+        while (!pq.empty()) {
+            size_t u = std::get<2>(pq.top());
+            pq.pop();
+            if (settled[u]) {
+                continue; // Stale entry
+            }
+            settled[u] = true;
+            numSettled++;
+            if (u == end) {
+                break;
+            }
+            sweep[u] = ShortestPaths::sweepOf(sweep, u, prev[u]);
+
+            for (size_t e = forward.offsets[u]; e < forward.offsets[u + 1]; ++e) {
+                size_t v = forward.targets[e];
+                long long candidate = dist[u] + forward.weights[e];
+                if (settled[v] || candidate > dist[v]) {
+                    continue;
+                }
+                if (candidate == dist[v]) {
+                    if (ShortestPaths::sweepsBefore(sweep, u, prev[v])) {
+                        prev[v] = u; // Same distance, Bellman-Ford's predecessor
+                    }
+                    continue;
+                }
+                long long h = lowerBound(v, end);
+                if (h == INF) {
+                    continue; // The target can't be reached through v
+                }
+                dist[v] = candidate;
+                prev[v] = u;
+                pq.push(Entry(candidate + h, candidate, v));
+            }
+        }
+
+        if (dist[end] != INF) {
+            for (size_t current = end; current != none; current = prev[current]) {
+                path.push_back(current);
+            }
+            std::reverse(path.begin(), path.end());
+        }
+        return numSettled;
+    }
+
+} // namespace ariel
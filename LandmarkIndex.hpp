@@ -0,0 +1,50 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef LANDMARKINDEX_HPP
+#define LANDMARKINDEX_HPP
+
+#include "Graph.hpp"
+#include "CSR.hpp"
+#include <vector>
+
+namespace ariel {
+
+    // ALT (A*, Landmarks, Triangle inequality) index for graphs with non-negative weights.
+    // Distances to and from k landmarks bound dist(v, t) from below, which steers an A* search
+    // towards the target instead of growing a Dijkstra ball around the source.
+    class LandmarkIndex {
+    public:
+        // Distance value used for unreachable vertices
+        static const long long INF;
+
+        // Constructor - picks numLandmarks landmarks and runs the 2k Dijkstra searches on numThreads
+        // threads (0 = hardware concurrency). Throws if the graph has negative weights.
+        LandmarkIndex(const Graph& graph, size_t numLandmarks, unsigned numThreads = 0);
+
+        // Getters
+        const std::vector<size_t>& getLandmarks() const;
+        size_t getNumVertices() const;
+
+        // Lower bound on the distance from v to target, INF if target can't be reached from v
+        long long lowerBound(size_t v, size_t target) const;
+
+        // A* search from start to end. Fills path with the vertices from start to end (empty if
+        // there is no path) and returns the number of vertices settled by the search.
+        size_t query(size_t start, size_t end, std::vector<size_t>& path) const;
+
+    private:
+        CSRGraph forward; // Out-edges used by the A* search
+        std::vector<size_t> landmarks;
+        std::vector<long long> fromLandmark; // fromLandmark[v * k + i] = dist(landmarks[i], v)
+        std::vector<long long> toLandmark;   // toLandmark[v * k + i] = dist(v, landmarks[i])
+
+        // Farthest-point landmark selection on the hop distances of the undirected graph
+        void selectLandmarks(const CSRGraph& backward, size_t numLandmarks);
+    };
+
+} // namespace ariel
+
+#endif // LANDMARKINDEX_HPP
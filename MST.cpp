@@ -0,0 +1,141 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "MST.hpp"
+#include "Components.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace ariel {
+    namespace {
+        // Weight of the undirected pair u-v: the lighter direction, 0 if neither is an edge.
+        // A symmetric matrix only needs the row of u.
+        int pairWeight(const Graph& graph, bool symmetric, size_t u, size_t v) {
+            int forward = graph.getWeight(u, v);
+            if (symmetric) {
+                return forward;
+            }
+            int backward = graph.getWeight(v, u);
+            if (forward == 0) {
+                return backward;
+            }
+            if (backward == 0) {
+                return forward;
+            }
+            return std::min(forward, backward);
+        }
+
+        // Lighter edges first, ties broken by endpoints so both methods are deterministic
+        bool lighterEdge(const Edge& a, const Edge& b) {
+            if (a.weight != b.weight) {
+                return a.weight < b.weight;
+            }
+            if (a.from != b.from) {
+                return a.from < b.from;
+            }
+            return a.to < b.to;
+        }
+    }
+
+    SpanningTree::SpanningTree() : totalWeight(0) {}
+
+    bool SpanningTree::isSpanning(size_t numVertices) const {
+        return edges.size() + 1 == numVertices;
+    }
+
+    SpanningTree SpanningTree::prim(const Graph& graph) {
+        const auto V = static_cast<size_t>(graph.getNumVertices());
+        const bool symmetric = graph.isSymmetric();
+        const size_t none = std::numeric_limits<size_t>::max();
+        std::vector<long long> key(V, std::numeric_limits<long long>::max()); // Lightest edge into the tree
+        std::vector<size_t> parent(V, none);
+        std::vector<bool> inTree(V, false);
+        SpanningTree tree;
+
+        for (size_t added = 0; added < V; ++added) {
+            // Closest vertex outside the tree; an unreachable one starts a new tree of the forest
+            size_t u = none;
+            for (size_t v = 0; v < V; ++v) {
+                if (!inTree[v] && (u == none || key[v] < key[u])) {
+                    u = v;
+                }
+            }
+            inTree[u] = true;
+            if (parent[u] != none) {
+                Edge edge = {std::min(u, parent[u]), std::max(u, parent[u]), static_cast<int>(key[u])};
+                tree.edges.push_back(edge);
+                tree.totalWeight += key[u];
+            }
+
+            for (size_t v = 0; v < V; ++v) {
+                if (inTree[v]) {
+                    continue;
+                }
+                int weight = pairWeight(graph, symmetric, u, v);
+                if (weight != 0 && weight < key[v]) {
+                    key[v] = weight;
+                    parent[v] = u;
+                }
+            }
+        }
+        return tree;
+    }
+
+    SpanningTree SpanningTree::kruskal(const Graph& graph, unsigned numThreads) {
+        const auto V = static_cast<size_t>(graph.getNumVertices());
+        const bool symmetric = graph.isSymmetric();
+        if (numThreads == 0) {
+            numThreads = defaultThreadCount();
+        }
+
+        // Every worker collects and sorts the pairs of its row range
+        std::vector<std::vector<Edge>> runs(numThreads);
+        unsigned workers = parallelRanges(V, numThreads, [&](size_t begin, size_t end, unsigned worker) {
+            std::vector<Edge>& run = runs[worker];
+            for (size_t u = begin; u < end; ++u) {
+                for (size_t v = u + 1; v < V; ++v) {
+                    int weight = pairWeight(graph, symmetric, u, v);
+                    if (weight != 0) {
+                        Edge edge = {u, v, weight};
+                        run.push_back(edge);
+                    }
+                }
+            }
+            std::sort(run.begin(), run.end(), lighterEdge);
+        });
+        runs.resize(workers);
+
+        // Merge the sorted runs pairwise, each round's merges in parallel
+        while (runs.size() > 1) {
+            std::vector<std::vector<Edge>> merged((runs.size() + 1) / 2);
+            parallelFor(merged.size(), numThreads, [&](size_t i) {
+                if (2 * i + 1 == runs.size()) {
+                    merged[i].swap(runs[2 * i]);
+                    return;
+                }
+                const std::vector<Edge>& a = runs[2 * i];
+                const std::vector<Edge>& b = runs[2 * i + 1];
+                merged[i].resize(a.size() + b.size());
+                std::merge(a.begin(), a.end(), b.begin(), b.end(), merged[i].begin(), lighterEdge);
+            });
+            runs.swap(merged);
+        }
+
+        SpanningTree tree;
+        DisjointSet sets(V);
+        for (const Edge& edge : runs.front()) {
+            if (sets.unite(edge.from, edge.to)) {
+                tree.edges.push_back(edge);
+                tree.totalWeight += edge.weight;
+                if (tree.edges.size() + 1 == V) {
+                    break;
+                }
+            }
+        }
+        return tree;
+    }
+
+} // namespace ariel
@@ -0,0 +1,38 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef MST_HPP
+#define MST_HPP
+
+#include "Graph.hpp"
+#include <vector>
+
+namespace ariel {
+
+    // Algorithm used to build a minimum spanning tree
+    enum class MSTMethod { Auto, Prim, Kruskal };
+
+    // Minimum spanning tree of a graph with edge directions ignored: a pair linked in both directions
+    // counts once, with the lighter of the two weights. A disconnected graph gets a spanning forest.
+    struct SpanningTree {
+        std::vector<Edge> edges; // Tree edges, from < to
+        long long totalWeight;   // Sum of the tree edge weights
+
+        SpanningTree();
+
+        // Check if the tree reaches all numVertices vertices
+        bool isSpanning(size_t numVertices) const;
+
+        // Array-based Prim in O(V^2), one pass over the adjacency matrix per added vertex
+        static SpanningTree prim(const Graph& graph);
+
+        // Kruskal in O(E log E): edges are collected and sorted per row range on numThreads threads
+        // (0 = every hardware thread), merged pairwise in parallel, then scanned with a union-find
+        static SpanningTree kruskal(const Graph& graph, unsigned numThreads = 0);
+    };
+
+} // namespace ariel
+
+#endif // MST_HPP
@@ -0,0 +1,249 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "MaxFlow.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace ariel {
+    namespace {
+        // Residual graph: every linked pair u-v gets one arc in each direction, stored next to
+        // the other arcs of its tail and pointing at its mate.
+        struct ResidualGraph {
+            std::vector<size_t> offsets;
+            std::vector<size_t> heads;
+            std::vector<size_t> mates;
+            std::vector<long long> capacities;
+
+            explicit ResidualGraph(const Graph& graph) {
+                auto V = static_cast<size_t>(graph.getNumVertices());
+                offsets.assign(V + 1, 0);
+                for (size_t u = 0; u < V; ++u) {
+                    for (size_t v = u + 1; v < V; ++v) {
+                        if (graph.getWeight(u, v) != 0 || graph.getWeight(v, u) != 0) {
+                            offsets[u + 1]++;
+                            offsets[v + 1]++;
+                        }
+                    }
+                }
+                for (size_t u = 0; u < V; ++u) {
+                    offsets[u + 1] += offsets[u];
+                }
+
+                heads.resize(offsets[V]);
+                mates.resize(offsets[V]);
+                capacities.resize(offsets[V]);
+                std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+                for (size_t u = 0; u < V; ++u) {
+                    for (size_t v = u + 1; v < V; ++v) {
+                        if (graph.getWeight(u, v) != 0 || graph.getWeight(v, u) != 0) {
+                            size_t forward = fill[u]++;
+                            size_t backward = fill[v]++;
+                            heads[forward] = v;
+                            heads[backward] = u;
+                            mates[forward] = backward;
+                            mates[backward] = forward;
+                            capacities[forward] = graph.getWeight(u, v);
+                            capacities[backward] = graph.getWeight(v, u);
+                        }
+                    }
+                }
+            }
+        };
+
+        class PushRelabel {
+        public:
+            PushRelabel(ResidualGraph& residual, size_t source, size_t sink)
+                : g(residual), n(residual.offsets.size() - 1), source(source), sink(sink),
+                  height(n, 0), excess(n, 0), current(n, 0), heightCount(n + 1, 0), active(n),
+                  highest(0), relabelsSinceUpdate(0) {}
+
+            long long run() {
+                // Saturate the arcs out of the source
+                for (size_t a = g.offsets[source]; a < g.offsets[source + 1]; ++a) {
+                    push(source, a, g.capacities[a]);
+                }
+                globalRelabel();
+
+                while (true) {
+                    while (highest > 0 && active[highest].empty()) {
+                        highest--;
+                    }
+                    if (active[highest].empty()) {
+                        break;
+                    }
+                    size_t v = active[highest].back();
+                    active[highest].pop_back();
+                    discharge(v);
+                    if (relabelsSinceUpdate >= n) {
+                        globalRelabel();
+                    }
+                }
+                return excess[sink];
+            }
+
+        private:
+            ResidualGraph& g;
+            size_t n;
+            size_t source;
+            size_t sink;
+            std::vector<size_t> height;
+            std::vector<long long> excess;
+            std::vector<size_t> current;                  // Next arc to try when discharging
+            std::vector<size_t> heightCount;              // Vertices at every height below n
+            std::vector<std::vector<size_t>> active;      // Active vertices bucketed by height
+            size_t highest;                               // No active vertex is above this height
+            size_t relabelsSinceUpdate;
+
+            void activate(size_t v) {
+                if (v != source && v != sink && height[v] < n) {
+                    active[height[v]].push_back(v);
+                    highest = std::max(highest, height[v]);
+                }
+            }
+
+            void push(size_t v, size_t arc, long long amount) {
+                size_t w = g.heads[arc];
+                bool wasIdle = excess[w] == 0;
+                g.capacities[arc] -= amount;
+                g.capacities[g.mates[arc]] += amount;
+                excess[v] -= amount;
+                excess[w] += amount;
+                if (wasIdle && amount > 0 && v != source) {
+                    activate(w);
+                }
+            }
+
+            // Exact distances to the sink by a reverse BFS; vertices cut off from it leave the first phase
+            void globalRelabel() {
+                relabelsSinceUpdate = 0;
+                std::fill(height.begin(), height.end(), n);
+                std::fill(heightCount.begin(), heightCount.end(), 0);
+                height[sink] = 0;
+                heightCount[0] = 1;
+                std::vector<size_t> queue(1, sink);
+                for (size_t head = 0; head < queue.size(); ++head) {
+                    size_t w = queue[head];
+                    for (size_t a = g.offsets[w]; a < g.offsets[w + 1]; ++a) {
+                        size_t v = g.heads[a];
+                        if (height[v] == n && v != source && g.capacities[g.mates[a]] > 0) {
+                            height[v] = height[w] + 1;
+                            heightCount[height[v]]++;
+                            queue.push_back(v);
+                        }
+                    }
+                }
+
+                highest = 0;
+                for (auto& bucket : active) {
+                    bucket.clear();
+                }
+                for (size_t v = 0; v < n; ++v) {
+                    current[v] = g.offsets[v];
+                    if (excess[v] > 0) {
+                        activate(v);
+                    }
+                }
+            }
+
+            void relabel(size_t v) {
+                relabelsSinceUpdate++;
+                size_t old = height[v];
+                heightCount[old]--;
+
+                // Gap: nothing is left at height old, so nothing above it can reach the sink
+                if (heightCount[old] == 0) {
+                    for (size_t u = 0; u < n; ++u) {
+                        if (height[u] > old && height[u] < n) {
+                            heightCount[height[u]]--;
+                            height[u] = n;
+                        }
+                    }
+                    for (size_t h = old + 1; h < n; ++h) {
+                        active[h].clear();
+                    }
+                    height[v] = n;
+                    return;
+                }
+
+                size_t lowest = n;
+                for (size_t a = g.offsets[v]; a < g.offsets[v + 1]; ++a) {
+                    if (g.capacities[a] > 0) {
+                        lowest = std::min(lowest, height[g.heads[a]] + 1);
+                    }
+                }
+                height[v] = std::min(lowest, n);
+                if (height[v] < n) {
+                    heightCount[height[v]]++;
+                }
+                current[v] = g.offsets[v];
+            }
+
+            void discharge(size_t v) {
+                while (excess[v] > 0 && height[v] < n) {
+                    if (current[v] == g.offsets[v + 1]) {
+                        relabel(v);
+                        continue;
+                    }
+                    size_t a = current[v];
+                    size_t w = g.heads[a];
+                    if (g.capacities[a] > 0 && height[v] == height[w] + 1) {
+                        push(v, a, std::min(excess[v], g.capacities[a]));
+                    } else {
+                        current[v]++;
+                    }
+                }
+            }
+        };
+    }
+
+    MaxFlow::MaxFlow() : value(0) {}
+
+    MaxFlow MaxFlow::pushRelabel(const Graph& graph, size_t source, size_t sink) {
+        auto V = static_cast<size_t>(graph.getNumVertices());
+        if (source >= V || sink >= V) {
+            throw std::invalid_argument("Invalid vertex: Vertex out of range.");
+        }
+        if (source == sink) {
+            throw std::invalid_argument("Invalid flow: The source and the sink must differ.");
+        }
+        if (graph.hasNegativeWeights()) {
+            throw std::invalid_argument("Invalid graph: Capacities can't be negative.");
+        }
+
+        ResidualGraph residual(graph);
+        MaxFlow result;
+        result.value = PushRelabel(residual, source, sink).run();
+
+        // Everything that can't reach the sink through residual arcs is on the source side
+        std::vector<bool> reachesSink(V, false);
+        reachesSink[sink] = true;
+        std::vector<size_t> queue(1, sink);
+        for (size_t head = 0; head < queue.size(); ++head) {
+            size_t w = queue[head];
+            for (size_t a = residual.offsets[w]; a < residual.offsets[w + 1]; ++a) {
+                size_t v = residual.heads[a];
+                if (!reachesSink[v] && residual.capacities[residual.mates[a]] > 0) {
+                    reachesSink[v] = true;
+                    queue.push_back(v);
+                }
+            }
+        }
+        result.sourceSide.resize(V);
+        for (size_t v = 0; v < V; ++v) {
+            result.sourceSide[v] = !reachesSink[v];
+        }
+        for (size_t u = 0; u < V; ++u) {
+            for (size_t v = 0; v < V; ++v) {
+                if (result.sourceSide[u] && !result.sourceSide[v] && graph.getWeight(u, v) > 0) {
+                    Edge edge = {u, v, graph.getWeight(u, v)};
+                    result.cutEdges.push_back(edge);
+                }
+            }
+        }
+        return result;
+    }
+
+} // namespace ariel
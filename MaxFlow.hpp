@@ -0,0 +1,31 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef MAXFLOW_HPP
+#define MAXFLOW_HPP
+
+#include "Graph.hpp"
+#include <vector>
+
+namespace ariel {
+
+    // Maximum flow between two vertices, edge weights taken as capacities, and a minimum cut.
+    struct MaxFlow {
+        long long value;              // Flow value, equal to the capacity of the cut
+        std::vector<bool> sourceSide; // Min-cut partition: vertices that can't reach the sink in the residual graph
+        std::vector<Edge> cutEdges;   // Edges from the source side to the sink side
+
+        MaxFlow();
+
+        // Highest-label push-relabel over a CSR residual graph, with periodic global relabeling
+        // (a reverse BFS from the sink) and the gap heuristic. Only the first phase runs: it
+        // finds the flow value and the cut without turning the preflow into a flow.
+        // Throws on negative capacities, equal endpoints or vertices out of range.
+        static MaxFlow pushRelabel(const Graph& graph, size_t source, size_t sink);
+    };
+
+} // namespace ariel
+
+#endif // MAXFLOW_HPP
@@ -0,0 +1,213 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ariel {
+
+    // Number of worker threads used when a caller asks for 0 threads
+    inline unsigned defaultThreadCount() {
+        unsigned count = std::thread::hardware_concurrency();
+        return count == 0 ? 1 : count;
+    }
+
+    // Runs task(i) for every i in [0, count), handing indices out dynamically to numThreads workers
+    // (0 means one worker per hardware thread). Runs inline when a single worker is enough.
+    template <typename Task>
+    void parallelFor(size_t count, unsigned numThreads, Task task) {
+        if (numThreads == 0) {
+            numThreads = defaultThreadCount();
+        }
+        size_t workers = std::min<size_t>(numThreads, count);
+        if (workers <= 1) {
+            for (size_t i = 0; i < count; ++i) {
+                task(i);
+            }
+            return;
+        }
+
+        std::atomic<size_t> next(0);
+        std::vector<std::thread> pool;
+        pool.reserve(workers);
+        for (size_t w = 0; w < workers; ++w) {
+            pool.emplace_back([&]() {
+                for (size_t i = next++; i < count; i = next++) {
+                    task(i);
+                }
+            });
+        }
+        for (auto& worker : pool) {
+            worker.join();
+        }
+    }
+
+    // Splits [0, count) into numThreads contiguous ranges (0 means one per hardware thread) and runs
+    // task(begin, end, worker) for each on its own thread. Returns the number of workers used.
+    template <typename Task>
+    unsigned parallelRanges(size_t count, unsigned numThreads, Task task) {
+        if (numThreads == 0) {
+            numThreads = defaultThreadCount();
+        }
+        auto workers = static_cast<unsigned>(std::max<size_t>(1, std::min<size_t>(numThreads, count)));
+        if (workers == 1) {
+            task(0, count, 0u);
+            return 1;
+        }
+
+        std::vector<std::thread> pool;
+        pool.reserve(workers);
+        for (unsigned w = 0; w < workers; ++w) {
+            size_t begin = count * w / workers;
+            size_t end = count * (w + 1) / workers;
+            pool.emplace_back([=, &task]() { task(begin, end, w); });
+        }
+        for (auto& worker : pool) {
+            worker.join();
+        }
+        return workers;
+    }
+
+    // Blocks each of count threads in wait() until all of them have arrived, then lets them all go.
+    // Reusable round after round.
+    class Barrier {
+    public:
+        explicit Barrier(size_t count) : total(count), count(count), waiting(0), generation(0) {}
+
+        void wait() {
+            std::unique_lock<std::mutex> lock(mutex);
+            size_t round = generation;
+            if (++waiting == count) {
+                waiting = 0;
+                generation++;
+                released.notify_all();
+                return;
+            }
+            released.wait(lock, [&]() { return generation != round; });
+        }
+
+        // Takes the calling thread out of the count until restore(), releasing the others if they
+        // were only waiting for it
+        void leave() {
+            std::lock_guard<std::mutex> lock(mutex);
+            count--;
+            if (waiting > 0 && waiting == count) {
+                waiting = 0;
+                generation++;
+                released.notify_all();
+            }
+        }
+
+        // Counts every thread that left again. No thread may be waiting.
+        void restore() {
+            std::lock_guard<std::mutex> lock(mutex);
+            count = total;
+        }
+
+    private:
+        std::mutex mutex;
+        std::condition_variable released;
+        size_t total;
+        size_t count;
+        size_t waiting;
+        size_t generation;
+    };
+
+    // numThreads workers (0 means one per hardware thread) kept alive between rounds, for algorithms
+    // that run many short parallel steps where starting threads every step would cost more than the
+    // step itself. The calling thread is worker 0. Not reentrant: one round at a time. A task that
+    // throws on any worker makes run rethrow, once every worker is done, and the team stays usable.
+    class WorkerTeam {
+    public:
+        explicit WorkerTeam(unsigned numThreads)
+            : numWorkers(numThreads == 0 ? defaultThreadCount() : numThreads), start(numWorkers), finish(numWorkers), step(numWorkers), stopping(false) {
+            for (unsigned w = 1; w < numWorkers; ++w) {
+                pool.emplace_back([this, w]() {
+                    while (true) {
+                        start.wait();
+                        if (stopping) {
+                            return;
+                        }
+                        work(w);
+                        finish.wait();
+                    }
+                });
+            }
+        }
+
+        ~WorkerTeam() {
+            stopping = true;
+            start.wait();
+            for (auto& worker : pool) {
+                worker.join();
+            }
+        }
+
+        WorkerTeam(const WorkerTeam&) = delete;
+        WorkerTeam& operator=(const WorkerTeam&) = delete;
+
+        unsigned size() const {
+            return numWorkers;
+        }
+
+        // Runs task(worker) on every worker and returns once all of them are done, rethrowing the
+        // first exception a worker threw
+        void run(const std::function<void(unsigned)>& task) {
+            job = task;
+            start.wait();
+            work(0);
+            finish.wait();
+            step.restore();
+            if (error) {
+                std::exception_ptr thrown;
+                thrown.swap(error);
+                std::rethrow_exception(thrown);
+            }
+        }
+
+        // Inside a round: waits until every worker of the team has reached the same call
+        void sync() {
+            step.wait();
+        }
+
+    private:
+        // Runs the round's job on worker w. On an exception w keeps it for run and leaves the round's
+        // syncs, so the other workers get through them to finish.
+        void work(unsigned w) {
+            try {
+                job(w);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                step.leave();
+            }
+        }
+
+        unsigned numWorkers;
+        Barrier start;
+        Barrier finish;
+        Barrier step;
+        bool stopping; // Set before the last start, read after it
+        std::function<void(unsigned)> job;
+        std::mutex errorMutex;
+        std::exception_ptr error; // First exception of the round
+        std::vector<std::thread> pool;
+    };
+
+} // namespace ariel
+
+#endif // PARALLEL_HPP
@@ -0,0 +1,111 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "PriorityQueues.hpp"
+#include <stdexcept>
+
+namespace ariel {
+
+    void BinaryHeapQueue::push(long long key, size_t vertex) {
+        heap.push(Entry(key, vertex));
+    }
+
+    std::pair<long long, size_t> BinaryHeapQueue::pop() {
+        if (heap.empty()) {
+            throw std::out_of_range("Pop from an empty queue");
+        }
+        Entry top = heap.top();
+        heap.pop();
+        return top;
+    }
+
+    bool BinaryHeapQueue::empty() const {
+        return heap.empty();
+    }
+
+    // Constructor
+    DialQueue::DialQueue(int maxWeight) : currentKey(0), size(0) {
+        if (maxWeight < 0) {
+            throw std::invalid_argument("Invalid queue: Dial's algorithm requires non-negative weights.");
+        }
+        buckets.resize(static_cast<size_t>(maxWeight) + 1);
+    }
+
+    void DialQueue::push(long long key, size_t vertex) {
+        buckets[static_cast<size_t>(key) % buckets.size()].push_back(vertex);
+        size++;
+    }
+
+    std::pair<long long, size_t> DialQueue::pop() {
+        if (size == 0) {
+            throw std::out_of_range("Pop from an empty queue");
+        }
+        // Live keys lie in [currentKey, currentKey + maxWeight], so one lap is enough
+        std::vector<size_t>* bucket = &buckets[static_cast<size_t>(currentKey) % buckets.size()];
+        while (bucket->empty()) {
+            currentKey++;
+            bucket = &buckets[static_cast<size_t>(currentKey) % buckets.size()];
+        }
+        size_t vertex = bucket->back();
+        bucket->pop_back();
+        size--;
+        return std::make_pair(currentKey, vertex);
+    }
+
+    bool DialQueue::empty() const {
+        return size == 0;
+    }
+
+    // Constructor
+    RadixHeap::RadixHeap() : lastKey(0), size(0) {}
+
+    size_t RadixHeap::bucketOf(long long key) const {
+        auto diff = static_cast<unsigned long long>(key ^ lastKey);
+        size_t bits = 0;
+        while (diff != 0) {
+            diff >>= 1;
+            bits++;
+        }
+        return bits;
+    }
+
+    void RadixHeap::push(long long key, size_t vertex) {
+        buckets[bucketOf(key)].push_back(std::make_pair(key, vertex));
+        size++;
+    }
+
+    std::pair<long long, size_t> RadixHeap::pop() {
+        if (size == 0) {
+            throw std::out_of_range("Pop from an empty queue");
+        }
+        if (buckets[0].empty()) {
+            // Redistribute the first non-empty bucket around its minimum, which becomes lastKey
+            size_t i = 1;
+            while (buckets[i].empty()) {
+                i++;
+            }
+            long long minKey = buckets[i][0].first;
+            for (const auto& entry : buckets[i]) {
+                if (entry.first < minKey) {
+                    minKey = entry.first;
+                }
+            }
+            lastKey = minKey;
+            for (const auto& entry : buckets[i]) {
+                buckets[bucketOf(entry.first)].push_back(entry);
+            }
+            buckets[i].clear();
+        }
+        std::pair<long long, size_t> top = buckets[0].back();
+        buckets[0].pop_back();
+        size--;
+        return top;
+    }
+
+    bool RadixHeap::empty() const {
+        return size == 0;
+    }
+
+} // namespace ariel
@@ -0,0 +1,72 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef PRIORITYQUEUES_HPP
+#define PRIORITYQUEUES_HPP
+
+#include <cstddef>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace ariel {
+
+    // Monotone priority queues for Dijkstra on non-negative integer weights: every pushed key must
+    // be at least the last popped key. Entries are (key, vertex) pairs.
+
+    // Binary heap baseline - O(log n) per operation, no restriction on the weights
+    class BinaryHeapQueue {
+    public:
+        void push(long long key, size_t vertex);
+        std::pair<long long, size_t> pop();
+        bool empty() const;
+
+    private:
+        typedef std::pair<long long, size_t> Entry;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    };
+
+    // Dial's algorithm - a circular array of maxWeight + 1 buckets, one per distance value.
+    // push is O(1), pop scans forward to the next non-empty bucket.
+    class DialQueue {
+    public:
+        // Constructor - keys may never exceed the last popped key by more than maxWeight
+        explicit DialQueue(int maxWeight);
+
+        void push(long long key, size_t vertex);
+        std::pair<long long, size_t> pop();
+        bool empty() const;
+
+    private:
+        std::vector<std::vector<size_t>> buckets;
+        long long currentKey; // Key of the bucket under the cursor
+        size_t size;
+    };
+
+    // Radix heap - bucket i holds keys that first differ from the last popped key at bit i - 1,
+    // so each entry moves down at most 64 times. Suits weights too large for DialQueue.
+    class RadixHeap {
+    public:
+        // Constructor
+        RadixHeap();
+
+        void push(long long key, size_t vertex);
+        std::pair<long long, size_t> pop();
+        bool empty() const;
+
+    private:
+        static const size_t NUM_BUCKETS = 65;
+        std::vector<std::pair<long long, size_t>> buckets[NUM_BUCKETS];
+        long long lastKey;
+        size_t size;
+
+        // Helper method to find the bucket of key relative to lastKey
+        size_t bucketOf(long long key) const;
+    };
+
+} // namespace ariel
+
+#endif // PRIORITYQUEUES_HPP
@@ -0,0 +1,126 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "SCC.hpp"
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace ariel {
+
+    size_t StrongComponents::count() const {
+        return sizes.size();
+    }
+
+    StrongComponents StrongComponents::fromGraph(const Graph& graph) {
+        return fromCSR(CSRGraph::fromGraph(graph));
+    }
+
+    StrongComponents StrongComponents::fromCSR(const CSRGraph& csr) {
+        const size_t V = csr.numVertices;
+        const size_t unvisited = std::numeric_limits<size_t>::max();
+        std::vector<size_t> index(V, unvisited);
+        std::vector<size_t> low(V, 0);
+        std::vector<bool> onStack(V, false);
+        std::vector<size_t> stack;                        // Tarjan's vertex stack
+        std::vector<std::pair<size_t, size_t>> callStack; // (vertex, next edge) replaces recursion
+        std::vector<size_t> tarjanId(V, 0);
+        size_t counter = 0;
+        size_t numComponents = 0;
+
+        for (size_t root = 0; root < V; ++root) {
+            if (index[root] != unvisited) {
+                continue;
+            }
+            index[root] = low[root] = counter++;
+            stack.push_back(root);
+            onStack[root] = true;
+            callStack.push_back(std::make_pair(root, csr.offsets[root]));
+
+            while (!callStack.empty()) {
+                size_t v = callStack.back().first;
+                size_t& edge = callStack.back().second;
+                if (edge < csr.offsets[v + 1]) {
+                    size_t w = csr.targets[edge++];
+                    if (index[w] == unvisited) {
+                        // "Recursive call" on w
+                        index[w] = low[w] = counter++;
+                        stack.push_back(w);
+                        onStack[w] = true;
+                        callStack.push_back(std::make_pair(w, csr.offsets[w]));
+                    } else if (onStack[w]) {
+                        low[v] = std::min(low[v], index[w]);
+                    }
+                    continue;
+                }
+
+                // All edges of v are done: v may close a component
+                if (low[v] == index[v]) {
+                    size_t w;
+                    do {
+                        w = stack.back();
+                        stack.pop_back();
+                        onStack[w] = false;
+                        tarjanId[w] = numComponents;
+                    } while (w != v);
+                    numComponents++;
+                }
+                callStack.pop_back();
+                if (!callStack.empty()) {
+                    size_t parent = callStack.back().first;
+                    low[parent] = std::min(low[parent], low[v]);
+                }
+            }
+        }
+
+        // Tarjan closes sink components first, so reversing the ids gives a topological order
+        StrongComponents result;
+        result.id.resize(V);
+        result.sizes.assign(numComponents, 0);
+        for (size_t v = 0; v < V; ++v) {
+            result.id[v] = numComponents - 1 - tarjanId[v];
+            result.sizes[result.id[v]]++;
+        }
+
+        // Group the vertices by component (counting sort) to emit the condensation row by row
+        std::vector<size_t> start(numComponents + 1, 0);
+        for (size_t c = 0; c < numComponents; ++c) {
+            start[c + 1] = start[c] + result.sizes[c];
+        }
+        std::vector<size_t> members(V);
+        std::vector<size_t> fill(start.begin(), start.end() - 1);
+        for (size_t v = 0; v < V; ++v) {
+            members[fill[result.id[v]]++] = v;
+        }
+
+        CSRGraph& dag = result.condensation;
+        dag.numVertices = numComponents;
+        dag.offsets.assign(numComponents + 1, 0);
+        std::vector<size_t> seenFrom(numComponents, unvisited); // Last source component with an edge to d
+        std::vector<size_t> slotOf(numComponents, 0);           // Where that edge is stored
+        for (size_t c = 0; c < numComponents; ++c) {
+            for (size_t i = start[c]; i < start[c + 1]; ++i) {
+                size_t u = members[i];
+                for (size_t e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e) {
+                    size_t d = result.id[csr.targets[e]];
+                    if (d == c) {
+                        continue;
+                    }
+                    if (seenFrom[d] != c) {
+                        seenFrom[d] = c;
+                        slotOf[d] = dag.targets.size();
+                        dag.targets.push_back(d);
+                        dag.weights.push_back(csr.weights[e]);
+                    } else {
+                        dag.weights[slotOf[d]] = std::min(dag.weights[slotOf[d]], csr.weights[e]);
+                    }
+                }
+            }
+            dag.offsets[c + 1] = dag.targets.size();
+        }
+        return result;
+    }
+
+} // namespace ariel
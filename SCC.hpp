@@ -0,0 +1,34 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef SCC_HPP
+#define SCC_HPP
+
+#include "Graph.hpp"
+#include "CSR.hpp"
+#include <vector>
+
+namespace ariel {
+
+    // Strongly connected components of a directed graph, found in O(V + E) by an iterative Tarjan
+    // search (explicit stacks, so deep graphs can't overflow the call stack).
+    struct StrongComponents {
+        std::vector<size_t> id;    // Component of every vertex, numbered in topological order of the condensation
+        std::vector<size_t> sizes; // Number of vertices in every component
+        CSRGraph condensation;     // One vertex per component, an edge c->d with the lightest weight of the edges between them
+
+        // Number of components
+        size_t count() const;
+
+        // Label the strongly connected components of graph and build the condensation DAG
+        static StrongComponents fromGraph(const Graph& graph);
+
+        // Same, over an adjacency list that is already built
+        static StrongComponents fromCSR(const CSRGraph& csr);
+    };
+
+} // namespace ariel
+
+#endif // SCC_HPP
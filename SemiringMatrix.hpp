@@ -0,0 +1,213 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef SEMIRINGMATRIX_HPP
+#define SEMIRINGMATRIX_HPP
+
+#include "Graph.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace ariel {
+
+    // Semirings for SemiringMatrix. Each one has a value type, an additive identity zero() that
+    // also annihilates under multiply (so the kernel can skip it), a multiplicative identity one(),
+    // add, multiply, and the value an edge of a given weight turns into.
+
+    // Ordinary arithmetic: products count (weighted) walks
+    template <typename Value>
+    struct BasicPlusTimes {
+        typedef Value value_type;
+        value_type zero() const { return 0; }
+        value_type one() const { return 1; }
+        value_type add(value_type a, value_type b) const { return a + b; }
+        value_type multiply(value_type a, value_type b) const { return a * b; }
+        template <typename Weight>
+        value_type fromWeight(Weight weight) const { return static_cast<value_type>(weight); }
+    };
+
+    // Plus-times on 64-bit integers
+    typedef BasicPlusTimes<long long> PlusTimes;
+
+    // Arithmetic modulo a modulus in [1, 2^31], so products of residues fit in 64 bits: walk counts
+    // that would overflow PlusTimes
+    struct ModPlusTimes {
+        typedef long long value_type;
+        long long modulus;
+        explicit ModPlusTimes(long long modulus = 1000000007) : modulus(modulus) {
+            if (modulus < 1 || modulus > (1LL << 31)) {
+                throw std::invalid_argument("Invalid modulus: It must be in [1, 2^31].");
+            }
+        }
+        value_type zero() const { return 0; }
+        value_type one() const { return 1 % modulus; }
+        value_type add(value_type a, value_type b) const { return (a + b) % modulus; }
+        value_type multiply(value_type a, value_type b) const { return a * b % modulus; }
+        template <typename Weight>
+        value_type fromWeight(Weight weight) const { return (static_cast<long long>(weight) % modulus + modulus) % modulus; }
+    };
+
+    // Tropical semiring: products give shortest walk lengths, zero() is "no walk"
+    struct MinPlus {
+        typedef long long value_type;
+        value_type zero() const { return std::numeric_limits<long long>::max() / 4; }
+        value_type one() const { return 0; }
+        value_type add(value_type a, value_type b) const { return std::min(a, b); }
+        value_type multiply(value_type a, value_type b) const { return a == zero() || b == zero() ? zero() : a + b; }
+        template <typename Weight>
+        value_type fromWeight(Weight weight) const { return static_cast<value_type>(weight); }
+    };
+
+    // Boolean semiring: products give reachability
+    struct OrAnd {
+        typedef unsigned char value_type;
+        value_type zero() const { return 0; }
+        value_type one() const { return 1; }
+        value_type add(value_type a, value_type b) const { return a | b; }
+        value_type multiply(value_type a, value_type b) const { return a & b; }
+        template <typename Weight>
+        value_type fromWeight(Weight) const { return 1; }
+    };
+
+    // Bottleneck semiring: products give the widest walk (largest minimum edge weight)
+    struct MaxMin {
+        typedef long long value_type;
+        value_type zero() const { return std::numeric_limits<long long>::min() / 4; }
+        value_type one() const { return std::numeric_limits<long long>::max() / 4; }
+        value_type add(value_type a, value_type b) const { return std::max(a, b); }
+        value_type multiply(value_type a, value_type b) const { return std::min(a, b); }
+        template <typename Weight>
+        value_type fromWeight(Weight weight) const { return static_cast<value_type>(weight); }
+    };
+
+    // Side of the square tiles the product kernel works on
+    const size_t SEMIRING_BLOCK = 64;
+
+    // c += a * b over ring for n x n row-major matrices. c must start out as ring.zero() (or hold
+    // a partial sum). Row blocks of c are handed to numThreads workers (0 = every hardware thread);
+    // inside a block the i-k-j loops run tile by tile and skip zero entries of a.
+    template <typename Semiring>
+    void semiringMultiply(const Semiring& ring, size_t n, const typename Semiring::value_type* a,
+                          const typename Semiring::value_type* b, typename Semiring::value_type* c, unsigned numThreads = 0) {
+        typedef typename Semiring::value_type value_type;
+        const value_type zero = ring.zero();
+        size_t numBlocks = (n + SEMIRING_BLOCK - 1) / SEMIRING_BLOCK;
+        parallelFor(numBlocks, numThreads, [&](size_t block) {
+            size_t iBegin = block * SEMIRING_BLOCK;
+            size_t iEnd = std::min(n, iBegin + SEMIRING_BLOCK);
+            for (size_t kBegin = 0; kBegin < n; kBegin += SEMIRING_BLOCK) {
+                size_t kEnd = std::min(n, kBegin + SEMIRING_BLOCK);
+                for (size_t jBegin = 0; jBegin < n; jBegin += SEMIRING_BLOCK) {
+                    size_t jEnd = std::min(n, jBegin + SEMIRING_BLOCK);
+                    for (size_t i = iBegin; i < iEnd; ++i) {
+                        value_type* row = c + i * n;
+                        for (size_t k = kBegin; k < kEnd; ++k) {
+                            value_type left = a[i * n + k];
+                            if (left == zero) {
+                                continue;
+                            }
+                            const value_type* right = b + k * n;
+                            for (size_t j = jBegin; j < jEnd; ++j) {
+                                row[j] = ring.add(row[j], ring.multiply(left, right[j]));
+                            }
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+    // Dense n x n matrix over a semiring
+    template <typename Semiring>
+    class SemiringMatrix {
+    public:
+        typedef typename Semiring::value_type value_type;
+
+        // Constructor - every cell is ring.zero()
+        explicit SemiringMatrix(size_t n, const Semiring& ring = Semiring())
+            : n(n), ring(ring), cells(n * n, ring.zero()) {}
+
+        // Adjacency matrix of graph: edges map through ring.fromWeight, missing edges to zero().
+        // reflexive puts one() on the diagonal, so products cover walks of up to k edges.
+        template <typename Weight>
+        static SemiringMatrix fromGraph(const BasicGraph<Weight>& graph, bool reflexive = false, const Semiring& ring = Semiring()) {
+            auto V = static_cast<size_t>(graph.getNumVertices());
+            SemiringMatrix matrix(V, ring);
+            for (size_t i = 0; i < V; ++i) {
+                for (size_t j = 0; j < V; ++j) {
+                    Weight weight = graph.getWeight(i, j);
+                    if (weight != 0) {
+                        matrix(i, j) = ring.fromWeight(weight);
+                    }
+                }
+                if (reflexive) {
+                    matrix(i, i) = ring.one();
+                }
+            }
+            return matrix;
+        }
+
+        // one() on the diagonal, zero() elsewhere
+        static SemiringMatrix identity(size_t n, const Semiring& ring = Semiring()) {
+            SemiringMatrix matrix(n, ring);
+            for (size_t i = 0; i < n; ++i) {
+                matrix(i, i) = ring.one();
+            }
+            return matrix;
+        }
+
+        size_t size() const { return n; }
+        const Semiring& semiring() const { return ring; }
+        value_type operator()(size_t i, size_t j) const { return cells[i * n + j]; }
+        value_type& operator()(size_t i, size_t j) { return cells[i * n + j]; }
+        const value_type* data() const { return cells.data(); }
+        value_type* data() { return cells.data(); }
+
+        // Product over the semiring on the blocked parallel kernel
+        SemiringMatrix multiply(const SemiringMatrix& other, unsigned numThreads = 0) const {
+            if (n != other.n) {
+                throw std::invalid_argument("Invalid operation: Matrices have different sizes.");
+            }
+            SemiringMatrix result(n, ring);
+            semiringMultiply(ring, n, cells.data(), other.cells.data(), result.cells.data(), numThreads);
+            return result;
+        }
+
+        SemiringMatrix operator*(const SemiringMatrix& other) const {
+            return multiply(other);
+        }
+
+    private:
+        size_t n;
+        Semiring ring;
+        std::vector<value_type> cells; // Row-major
+    };
+
+    // base^k by repeated squaring: about log2(k) + popcount(k) products instead of k - 1.
+    // k = 0 gives the identity.
+    template <typename Semiring>
+    SemiringMatrix<Semiring> pow(const SemiringMatrix<Semiring>& base, unsigned long long k, unsigned numThreads = 0) {
+        SemiringMatrix<Semiring> result(0, base.semiring());
+        bool started = false; // result still stands for the identity
+        SemiringMatrix<Semiring> square = base;
+        while (k > 0) {
+            if (k & 1) {
+                result = started ? result.multiply(square, numThreads) : square;
+                started = true;
+            }
+            k >>= 1;
+            if (k > 0) {
+                square = square.multiply(square, numThreads);
+            }
+        }
+        return started ? result : SemiringMatrix<Semiring>::identity(base.size(), base.semiring());
+    }
+
+} // namespace ariel
+
+#endif // SEMIRINGMATRIX_HPP
@@ -0,0 +1,271 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "ShortestPaths.hpp"
+#include "Parallel.hpp"
+#include "PriorityQueues.hpp"
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace ariel {
+
+    const long long ShortestPaths::INF = std::numeric_limits<long long>::max() / 4;
+
+    const size_t ShortestPaths::NONE = std::numeric_limits<size_t>::max();
+
+    const int ShortestPaths::DIAL_MAX_WEIGHT = 1024;
+
+    namespace {
+        // Dijkstra over any monotone queue with push(key, vertex) / pop() / empty()
+        template <typename Queue>
+        void runDijkstra(const CSRGraph& csr, size_t source, size_t target, Queue& queue,
+                         std::vector<long long>& dist, std::vector<size_t>& prev) {
+            dist.assign(csr.numVertices, ShortestPaths::INF);
+            prev.assign(csr.numVertices, ShortestPaths::NONE);
+            std::vector<size_t> sweep(csr.numVertices, 0);
+            dist[source] = 0;
+            queue.push(0, source);
+
+            while (!queue.empty()) {
+                std::pair<long long, size_t> top = queue.pop();
+                size_t u = top.second;
+                if (top.first != dist[u]) {
+                    continue; // Stale entry
+                }
+                if (u == target) {
+                    break;
+                }
+                sweep[u] = ShortestPaths::sweepOf(sweep, u, prev[u]);
+                for (size_t e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e) {
+                    size_t v = csr.targets[e];
+                    long long candidate = dist[u] + csr.weights[e];
+                    if (candidate < dist[v]) {
+                        dist[v] = candidate;
+                        prev[v] = u;
+                        queue.push(candidate, v);
+                    } else if (candidate == dist[v] && ShortestPaths::sweepsBefore(sweep, u, prev[v])) {
+                        prev[v] = u; // Same distance, Bellman-Ford's predecessor
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<long long> ShortestPaths::dijkstra(const CSRGraph& csr, size_t source) {
+        std::vector<long long> dist;
+        std::vector<size_t> prev;
+        BinaryHeapQueue queue;
+        runDijkstra(csr, source, NONE, queue, dist, prev);
+        return dist;
+    }
+
+    size_t ShortestPaths::sweepOf(const std::vector<size_t>& sweep, size_t u, size_t p) {
+        if (p == NONE) {
+            return 0;
+        }
+        return p < u ? sweep[p] : sweep[p] + 1;
+    }
+
+    bool ShortestPaths::sweepsBefore(const std::vector<size_t>& sweep, size_t u, size_t p) {
+        return p != NONE && (sweep[u] < sweep[p] || (sweep[u] == sweep[p] && u < p));
+    }
+
+    QueueBackend ShortestPaths::selectBackend(int maxWeight) {
+        return maxWeight <= DIAL_MAX_WEIGHT ? QueueBackend::Dial : QueueBackend::RadixHeap;
+    }
+
+    void ShortestPaths::dijkstra(const CSRGraph& csr, size_t source, size_t target, QueueBackend backend, int maxWeight,
+                                 std::vector<long long>& dist, std::vector<size_t>& prev) {
+        if (backend == QueueBackend::Auto) {
+            backend = selectBackend(maxWeight);
+        }
+        switch (backend) {
+            case QueueBackend::Dial: {
+                DialQueue queue(maxWeight);
+                runDijkstra(csr, source, target, queue, dist, prev);
+                break;
+            }
+            case QueueBackend::RadixHeap: {
+                RadixHeap queue;
+                runDijkstra(csr, source, target, queue, dist, prev);
+                break;
+            }
+            default: {
+                BinaryHeapQueue queue;
+                runDijkstra(csr, source, target, queue, dist, prev);
+                break;
+            }
+        }
+    }
+
+    long long ShortestPaths::defaultDelta(const CSRGraph& csr) {
+        if (csr.numEdges() == 0) {
+            return 1;
+        }
+        int maxWeight = *std::max_element(csr.weights.begin(), csr.weights.end());
+        auto averageDegree = static_cast<long long>(std::max<size_t>(1, csr.numEdges() / std::max<size_t>(1, csr.numVertices)));
+        return std::max(1LL, maxWeight / averageDegree);
+    }
+
+    std::vector<long long> ShortestPaths::deltaStepping(const CSRGraph& csr, size_t source, long long delta, unsigned numThreads) {
+        typedef std::pair<size_t, long long> Request; // (vertex, tentative distance)
+        if (delta <= 0) {
+            delta = defaultDelta(csr);
+        }
+        WorkerTeam team(numThreads); // Started once, reused by every relaxation round
+        const size_t T = team.size();
+        const size_t V = csr.numVertices;
+        const size_t none = std::numeric_limits<size_t>::max();
+
+        // A relaxation from bucket i lands at most maxWeight / delta + 1 buckets further, so a ring of
+        // that many bucket vectors holds every live bucket; past V + 1 buckets the rest wait in overflow
+        int maxWeight = csr.numEdges() == 0 ? 0 : *std::max_element(csr.weights.begin(), csr.weights.end());
+        const size_t B = static_cast<size_t>(std::min<long long>(maxWeight / delta + 2, static_cast<long long>(V) + 1));
+        std::vector<std::vector<size_t>> ring(B);                // ring[i % B] holds bucket i
+        std::vector<std::pair<size_t, size_t>> overflow;         // (bucket, vertex) beyond the ring
+        size_t overflowMin = none;                               // Lowest bucket in overflow
+        size_t current = 0;                                      // Bucket being settled
+        size_t queued = 0;                                       // Entries in the ring and overflow
+
+        std::vector<long long> dist(V, INF);
+        std::vector<size_t> phaseStamp(V, none);       // Last phase that expanded the vertex
+        std::vector<size_t> bucketStamp(V, none);      // Last bucket the vertex was settled in
+        std::vector<std::vector<Request>> requests(T * T); // requests[worker * T + owner]
+        std::vector<std::vector<std::pair<size_t, size_t>>> inserted(T); // (bucket, vertex) per owner
+
+        auto enqueue = [&](size_t bucket, size_t v) {
+            if (bucket < current + B) {
+                ring[bucket % B].push_back(v);
+            } else {
+                overflow.push_back(std::make_pair(bucket, v));
+                overflowMin = std::min(overflowMin, bucket);
+            }
+            queued++;
+        };
+
+        // Relax the light or heavy out-edges of frontier in one round of the team. Workers gather
+        // requests into buffers keyed by the owner of the target, then each owner applies its
+        // requests without locking.
+        auto relax = [&](const std::vector<size_t>& frontier, bool light) {
+            team.run([&](unsigned worker) {
+                for (size_t owner = 0; owner < T; ++owner) {
+                    requests[worker * T + owner].clear();
+                }
+                for (size_t i = frontier.size() * worker / T; i < frontier.size() * (worker + 1) / T; ++i) {
+                    size_t u = frontier[i];
+                    for (size_t e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e) {
+                        if ((csr.weights[e] <= delta) != light) {
+                            continue;
+                        }
+                        size_t v = csr.targets[e];
+                        long long candidate = dist[u] + csr.weights[e];
+                        if (candidate < dist[v]) {
+                            requests[worker * T + v * T / V].push_back(Request(v, candidate));
+                        }
+                    }
+                }
+                team.sync();
+
+                // Worker w owns the targets v with v * T / V == w
+                inserted[worker].clear();
+                for (size_t from = 0; from < T; ++from) {
+                    for (const Request& request : requests[from * T + worker]) {
+                        if (request.second < dist[request.first]) {
+                            dist[request.first] = request.second;
+                            inserted[worker].push_back(std::make_pair(static_cast<size_t>(request.second / delta), request.first));
+                        }
+                    }
+                }
+            });
+            for (const auto& list : inserted) {
+                for (const auto& entry : list) {
+                    enqueue(entry.first, entry.second);
+                }
+            }
+        };
+
+        dist[source] = 0;
+        enqueue(0, source);
+        size_t phase = 0;
+        std::vector<size_t> frontier;
+        std::vector<size_t> settled;
+
+        while (queued > 0) {
+            // Next non-empty bucket: in the ring if any, else the lowest one in overflow
+            size_t next = current;
+            while (next < current + B && ring[next % B].empty()) {
+                ++next;
+            }
+            current = next < current + B ? next : overflowMin;
+            if (overflowMin < current + B) {
+                // The ring moved forward: bring the overflow entries it now covers in
+                std::vector<std::pair<size_t, size_t>> later;
+                overflowMin = none;
+                for (const auto& entry : overflow) {
+                    if (entry.first < current + B) {
+                        ring[entry.first % B].push_back(entry.second);
+                    } else {
+                        later.push_back(entry);
+                        overflowMin = std::min(overflowMin, entry.first);
+                    }
+                }
+                overflow.swap(later);
+            }
+            settled.clear();
+
+            // Light edges can refill the current bucket, so keep going until it stays empty
+            while (!ring[current % B].empty()) {
+                frontier.clear();
+                frontier.swap(ring[current % B]); // The bucket keeps the old frontier's capacity
+                queued -= frontier.size();
+
+                // Drop stale entries (vertices that moved to a lower distance) and duplicates
+                phase++;
+                size_t kept = 0;
+                for (size_t v : frontier) {
+                    if (phaseStamp[v] != phase && static_cast<size_t>(dist[v] / delta) == current) {
+                        phaseStamp[v] = phase;
+                        frontier[kept++] = v;
+                        if (bucketStamp[v] != current) {
+                            bucketStamp[v] = current;
+                            settled.push_back(v);
+                        }
+                    }
+                }
+                frontier.resize(kept);
+                relax(frontier, true);
+            }
+
+            // Heavy edges always leave the bucket, one round is enough
+            relax(settled, false);
+        }
+        return dist;
+    }
+
+    void ShortestPaths::dagShortestPaths(const CSRGraph& csr, const std::vector<size_t>& order, size_t source,
+                                         std::vector<long long>& dist, std::vector<size_t>& prev) {
+        dist.assign(csr.numVertices, INF);
+        prev.assign(csr.numVertices, NONE);
+        std::vector<size_t> sweep(csr.numVertices, 0);
+        dist[source] = 0;
+        for (size_t u : order) {
+            if (dist[u] == INF) {
+                continue; // Not reached yet, so never reached: every edge into u came earlier
+            }
+            sweep[u] = sweepOf(sweep, u, prev[u]);
+            for (size_t e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e) {
+                size_t v = csr.targets[e];
+                if (dist[u] + csr.weights[e] < dist[v]) {
+                    dist[v] = dist[u] + csr.weights[e];
+                    prev[v] = u;
+                } else if (dist[u] + csr.weights[e] == dist[v] && sweepsBefore(sweep, u, prev[v])) {
+                    prev[v] = u;
+                }
+            }
+        }
+    }
+
+} // namespace ariel
@@ -0,0 +1,67 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef SHORTESTPATHS_HPP
+#define SHORTESTPATHS_HPP
+
+#include "CSR.hpp"
+#include <vector>
+
+namespace ariel {
+
+    // Priority queue used by Dijkstra. Auto picks Dial for small maximum weights, radix heap otherwise.
+    enum class QueueBackend { Auto, BinaryHeap, Dial, RadixHeap };
+
+    // Single source shortest path engines over a CSR graph with non-negative weights.
+    // Distances are 64-bit so long paths of int weights can't overflow.
+    class ShortestPaths {
+    public:
+        // Distance value of unreachable vertices
+        static const long long INF;
+
+        // Vertex value used for "no vertex" in predecessor arrays and as a target meaning "settle everything"
+        static const size_t NONE;
+
+        // Largest maximum weight for which Auto picks Dial's bucket queue
+        static const int DIAL_MAX_WEIGHT;
+
+        // Sequential binary heap Dijkstra
+        static std::vector<long long> dijkstra(const CSRGraph& csr, size_t source);
+
+        // Dijkstra on the chosen queue, filling dist and prev (predecessor on a shortest path).
+        // Stops as soon as target is settled. maxWeight must bound every weight in csr.
+        static void dijkstra(const CSRGraph& csr, size_t source, size_t target, QueueBackend backend, int maxWeight,
+                             std::vector<long long>& dist, std::vector<size_t>& prev);
+
+        // Predecessor tie-break shared by every search, so they all return Bellman-Ford's path.
+        // Algorithms::shortestPath<Weight> sweeps u = 0..V-1 and keeps the first predecessor it relaxes
+        // from once that predecessor's distance is final. sweep[u] numbers the sweep where that happens
+        // for u: 0 for the source, sweep[p] when u's predecessor p comes before u, sweep[p] + 1 after it.
+        static size_t sweepOf(const std::vector<size_t>& sweep, size_t u, size_t p);
+
+        // On equal distances u replaces the predecessor p: Bellman-Ford reaches u first
+        static bool sweepsBefore(const std::vector<size_t>& sweep, size_t u, size_t p);
+
+        // Backend Auto resolves to for a graph whose weights are at most maxWeight
+        static QueueBackend selectBackend(int maxWeight);
+
+        // Delta-stepping: vertices are kept in buckets of width delta and each bucket is settled
+        // by parallel rounds of light (w <= delta) edge relaxations, followed by one round over
+        // the heavy edges. delta = 0 picks maxWeight / averageDegree, numThreads = 0 uses every
+        // hardware thread.
+        static std::vector<long long> deltaStepping(const CSRGraph& csr, size_t source, long long delta = 0, unsigned numThreads = 0);
+
+        // Bucket width used by deltaStepping when none is given
+        static long long defaultDelta(const CSRGraph& csr);
+
+        // Shortest paths of a DAG in O(V + E): every edge is relaxed once, in topological order.
+        // Negative weights are fine. order must be a topological order of csr covering every vertex.
+        static void dagShortestPaths(const CSRGraph& csr, const std::vector<size_t>& order, size_t source,
+                                     std::vector<long long>& dist, std::vector<size_t>& prev);
+    };
+
+} // namespace ariel
+
+#endif // SHORTESTPATHS_HPP
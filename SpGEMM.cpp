@@ -0,0 +1,84 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "SpGEMM.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace ariel {
+
+    SparseProduct::SparseProduct() : numVertices(0), offsets(1, 0) {}
+
+    size_t SparseProduct::numNonZeros() const {
+        return columns.size();
+    }
+
+    SparseProduct SparseProduct::multiply(const CSRGraph& a, const CSRGraph& b, unsigned numThreads) {
+        if (a.numVertices != b.numVertices) {
+            throw std::invalid_argument("Invalid operation: Matrices have different sizes.");
+        }
+        const size_t n = a.numVertices;
+        const size_t unused = std::numeric_limits<size_t>::max();
+        if (numThreads == 0) {
+            numThreads = defaultThreadCount();
+        }
+
+        // Every worker fills its own contiguous block of rows
+        std::vector<std::vector<size_t>> rowSizes(numThreads);
+        std::vector<std::vector<size_t>> blockColumns(numThreads);
+        std::vector<std::vector<long long>> blockValues(numThreads);
+        std::vector<size_t> firstRow(numThreads, 0);
+        unsigned workers = parallelRanges(n, numThreads, [&](size_t begin, size_t end, unsigned worker) {
+            std::vector<long long> accumulator(n, 0);
+            std::vector<size_t> lastRow(n, unused); // Row in which a column was last touched
+            std::vector<size_t> touched;
+            firstRow[worker] = begin;
+            for (size_t i = begin; i < end; ++i) {
+                touched.clear();
+                for (size_t ea = a.offsets[i]; ea < a.offsets[i + 1]; ++ea) {
+                    long long scale = a.weights[ea];
+                    size_t k = a.targets[ea];
+                    for (size_t eb = b.offsets[k]; eb < b.offsets[k + 1]; ++eb) {
+                        size_t j = b.targets[eb];
+                        if (lastRow[j] != i) {
+                            lastRow[j] = i;
+                            accumulator[j] = 0;
+                            touched.push_back(j);
+                        }
+                        accumulator[j] += scale * b.weights[eb];
+                    }
+                }
+
+                std::sort(touched.begin(), touched.end());
+                size_t size = 0;
+                for (size_t j : touched) {
+                    if (accumulator[j] != 0) {
+                        blockColumns[worker].push_back(j);
+                        blockValues[worker].push_back(accumulator[j]);
+                        size++;
+                    }
+                }
+                rowSizes[worker].push_back(size);
+            }
+        });
+
+        // Stitch the blocks together in row order
+        SparseProduct result;
+        result.numVertices = n;
+        result.offsets.assign(n + 1, 0);
+        for (unsigned w = 0; w < workers; ++w) {
+            for (size_t r = 0; r < rowSizes[w].size(); ++r) {
+                size_t row = firstRow[w] + r;
+                result.offsets[row + 1] = result.offsets[row] + rowSizes[w][r];
+            }
+            result.columns.insert(result.columns.end(), blockColumns[w].begin(), blockColumns[w].end());
+            result.values.insert(result.values.end(), blockValues[w].begin(), blockValues[w].end());
+        }
+        return result;
+    }
+
+} // namespace ariel
@@ -0,0 +1,36 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef SPGEMM_HPP
+#define SPGEMM_HPP
+
+#include "CSR.hpp"
+#include <vector>
+
+namespace ariel {
+
+    // Sparse product of two CSR matrices with 64-bit values, stored row by row like a CSRGraph.
+    // The non-zeros of row i are columns/values[offsets[i] .. offsets[i + 1]), in increasing column order.
+    struct SparseProduct {
+        size_t numVertices;
+        std::vector<size_t> offsets;
+        std::vector<size_t> columns;
+        std::vector<long long> values;
+
+        SparseProduct();
+
+        // Gustavson's row-by-row product a * b: row i of the result accumulates b's rows scaled by
+        // the entries of a's row i in a dense per-thread accumulator, touching only the columns
+        // that occur. Rows are split into numThreads ranges (0 = every hardware thread).
+        // Entries that cancel out to 0 are dropped.
+        static SparseProduct multiply(const CSRGraph& a, const CSRGraph& b, unsigned numThreads = 0);
+
+        // Number of stored entries
+        size_t numNonZeros() const;
+    };
+
+} // namespace ariel
+
+#endif // SPGEMM_HPP
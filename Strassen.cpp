@@ -0,0 +1,136 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "Strassen.hpp"
+#include "SemiringMatrix.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace ariel {
+    namespace {
+        typedef std::vector<long long> Block; // Square row-major block
+
+        void add(const Block& x, const Block& y, Block& out) {
+            for (size_t i = 0; i < out.size(); ++i) {
+                out[i] = x[i] + y[i];
+            }
+        }
+
+        void subtract(const Block& x, const Block& y, Block& out) {
+            for (size_t i = 0; i < out.size(); ++i) {
+                out[i] = x[i] - y[i];
+            }
+        }
+
+        // Copy the four h x h quadrants of the 2h x 2h matrix m
+        void split(const long long* m, size_t h, Block& q11, Block& q12, Block& q21, Block& q22) {
+            for (size_t i = 0; i < h; ++i) {
+                const long long* top = m + i * 2 * h;
+                const long long* bottom = m + (i + h) * 2 * h;
+                std::copy(top, top + h, q11.begin() + static_cast<std::ptrdiff_t>(i * h));
+                std::copy(top + h, top + 2 * h, q12.begin() + static_cast<std::ptrdiff_t>(i * h));
+                std::copy(bottom, bottom + h, q21.begin() + static_cast<std::ptrdiff_t>(i * h));
+                std::copy(bottom + h, bottom + 2 * h, q22.begin() + static_cast<std::ptrdiff_t>(i * h));
+            }
+        }
+
+        // c = a * b for m x m matrices, m = leaf * 2^depth with leaf <= cutoff
+        void recurse(size_t m, const long long* a, const long long* b, long long* c, size_t cutoff, unsigned numThreads) {
+            if (m <= cutoff) {
+                std::fill(c, c + m * m, 0);
+                semiringMultiply(PlusTimes(), m, a, b, c, 1);
+                return;
+            }
+
+            size_t h = m / 2;
+            Block a11(h * h), a12(h * h), a21(h * h), a22(h * h);
+            Block b11(h * h), b12(h * h), b21(h * h), b22(h * h);
+            split(a, h, a11, a12, a21, a22);
+            split(b, h, b11, b12, b21, b22);
+
+            // Winograd's 8 pre-additions
+            Block s1(h * h), s2(h * h), s3(h * h), s4(h * h);
+            Block t1(h * h), t2(h * h), t3(h * h), t4(h * h);
+            add(a21, a22, s1);
+            subtract(s1, a11, s2);
+            subtract(a11, a21, s3);
+            subtract(a12, s2, s4);
+            subtract(b12, b11, t1);
+            subtract(b22, t1, t2);
+            subtract(b22, b12, t3);
+            subtract(t2, b21, t4);
+
+            // The 7 products are independent: the top level hands them to threads
+            const Block* left[7] = {&a11, &a12, &s4, &a22, &s1, &s2, &s3};
+            const Block* right[7] = {&b11, &b21, &b22, &t4, &t1, &t2, &t3};
+            std::vector<Block> products(7, Block(h * h));
+            parallelFor(7, numThreads, [&](size_t p) {
+                recurse(h, left[p]->data(), right[p]->data(), products[p].data(), cutoff, 1);
+            });
+
+            // And the 7 post-additions
+            Block& m1 = products[0];
+            Block& m2 = products[1];
+            Block& m3 = products[2];
+            Block& m4 = products[3];
+            Block& m5 = products[4];
+            Block& m6 = products[5];
+            Block& m7 = products[6];
+            Block c11(h * h), c12(h * h), c21(h * h), c22(h * h);
+            add(m1, m2, c11);
+            add(m1, m6, m6);  // U2
+            add(m6, m7, m7);  // U3
+            add(m6, m5, m6);  // U4
+            add(m6, m3, c12); // U5
+            subtract(m7, m4, c21);
+            add(m7, m5, c22);
+
+            for (size_t i = 0; i < h; ++i) {
+                long long* top = c + i * 2 * h;
+                long long* bottom = c + (i + h) * 2 * h;
+                auto offset = static_cast<std::ptrdiff_t>(i * h);
+                std::copy(c11.begin() + offset, c11.begin() + offset + static_cast<std::ptrdiff_t>(h), top);
+                std::copy(c12.begin() + offset, c12.begin() + offset + static_cast<std::ptrdiff_t>(h), top + h);
+                std::copy(c21.begin() + offset, c21.begin() + offset + static_cast<std::ptrdiff_t>(h), bottom);
+                std::copy(c22.begin() + offset, c22.begin() + offset + static_cast<std::ptrdiff_t>(h), bottom + h);
+            }
+        }
+    }
+
+    const size_t Strassen::DEFAULT_CUTOFF = 128;
+
+    void Strassen::multiply(size_t n, const long long* a, const long long* b, long long* c, size_t cutoff, unsigned numThreads) {
+        if (cutoff == 0) {
+            cutoff = 1;
+        }
+        if (n <= cutoff) {
+            recurse(n, a, b, c, cutoff, numThreads);
+            return;
+        }
+
+        // Pad to leaf * 2^depth, the smallest such size with leaf <= cutoff
+        size_t leaf = n;
+        size_t depth = 0;
+        while (leaf > cutoff) {
+            leaf = (leaf + 1) / 2;
+            depth++;
+        }
+        size_t m = leaf << depth;
+        if (m == n) {
+            recurse(n, a, b, c, cutoff, numThreads);
+            return;
+        }
+        Block paddedA(m * m, 0), paddedB(m * m, 0), paddedC(m * m, 0);
+        for (size_t i = 0; i < n; ++i) {
+            std::copy(a + i * n, a + (i + 1) * n, paddedA.begin() + static_cast<std::ptrdiff_t>(i * m));
+            std::copy(b + i * n, b + (i + 1) * n, paddedB.begin() + static_cast<std::ptrdiff_t>(i * m));
+        }
+        recurse(m, paddedA.data(), paddedB.data(), paddedC.data(), cutoff, numThreads);
+        for (size_t i = 0; i < n; ++i) {
+            std::copy(paddedC.begin() + static_cast<std::ptrdiff_t>(i * m), paddedC.begin() + static_cast<std::ptrdiff_t>(i * m + n), c + i * n);
+        }
+    }
+
+} // namespace ariel
@@ -0,0 +1,30 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef STRASSEN_HPP
+#define STRASSEN_HPP
+
+#include <cstddef>
+
+namespace ariel {
+
+    // Strassen-Winograd multiplication of dense 64-bit matrices: 7 half-size products and 15
+    // additions per level instead of 8 products. Sizes are padded with zeros to leaf * 2^depth
+    // so every level halves evenly, and blocks of at most cutoff rows go to the blocked
+    // plus-times kernel.
+    class Strassen {
+    public:
+        // Leaf size used when none is given, from the crossover measured by make bench
+        static const size_t DEFAULT_CUTOFF;
+
+        // c = a * b for n x n row-major matrices. The 7 top-level products run on numThreads
+        // threads (0 = every hardware thread).
+        static void multiply(size_t n, const long long* a, const long long* b, long long* c,
+                             size_t cutoff = DEFAULT_CUTOFF, unsigned numThreads = 0);
+    };
+
+} // namespace ariel
+
+#endif // STRASSEN_HPP
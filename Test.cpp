@@ -5,11 +5,30 @@ Name: Daniel Kuris
 */
 
 #include <sstream>
+#include <cstring>
+#include <cstddef>
 #include "Graph.hpp"
 #include "Algorithms.hpp"
+#include "LandmarkIndex.hpp"
+#include "ShortestPaths.hpp"
+#include "PriorityQueues.hpp"
+#include "Parallel.hpp"
+#include "IncrementalConnectivity.hpp"
+#include "SemiringMatrix.hpp"
+#include "SpGEMM.hpp"
+#include "Strassen.hpp"
+#include "FixedGraph.hpp"
+#include "BitGraph.hpp"
+#include "GraphBatch.hpp"
+#include "GraphParser.hpp"
+#include "Varint.hpp"
+#include "CompressedGraph.hpp"
+#include <fstream>
 #include <vector>
 #include <string>
 #include <stdexcept>
+#include <random>
+#include <thread>
 #include "doctest.h" 
 #include <iostream>
 
@@ -545,3 +564,2023 @@ TEST_CASE("Visual representation of a graph") {
         CHECK(output.str() == expectedOutput);
     }
 }
+
+// --------------------- SHORTEST PATH ENGINE TESTS ---------------------
+
+// Undirected side x side grid where every edge weighs weight
+static vector<vector<int>> gridMatrix(size_t side, int weight)
+{
+    size_t V = side * side;
+    vector<vector<int>> matrix(V, vector<int>(V, 0));
+    for (size_t r = 0; r < side; ++r) {
+        for (size_t c = 0; c < side; ++c) {
+            size_t u = r * side + c;
+            if (c + 1 < side) {
+                matrix[u][u + 1] = matrix[u + 1][u] = weight;
+            }
+            if (r + 1 < side) {
+                matrix[u][u + side] = matrix[u + side][u] = weight;
+            }
+        }
+    }
+    return matrix;
+}
+
+TEST_CASE("Test landmark index bounds and queries")
+{
+    ariel::Graph g;
+    g.loadGraph(gridMatrix(12, 1));
+    ariel::LandmarkIndex index(g, 4);
+    CHECK(index.getLandmarks().size() == 4);
+
+    // Manhattan distance is the exact distance on a unit grid, the bound must never exceed it
+    CHECK(index.lowerBound(0, 143) <= 22);
+    CHECK(index.lowerBound(143, 143) == 0);
+
+    vector<size_t> path;
+    size_t altSettled = index.query(0, 143, path);
+    CHECK(path.size() == 23);
+    CHECK(path.front() == 0);
+    CHECK(path.back() == 143);
+
+    ariel::LandmarkIndex plain(g, 0);
+    size_t dijkstraSettled = plain.query(0, 11, path);
+    CHECK(path.size() == 12);
+    CHECK(index.query(0, 11, path) < dijkstraSettled);
+    CHECK(altSettled <= 144);
+}
+
+TEST_CASE("Test concurrent shortestPath queries share one landmark index")
+{
+    ariel::Graph g;
+    g.loadGraph(gridMatrix(17, 1));
+    string expected = ariel::Algorithms::shortestPath(ariel::Graph(g), 0, 288);
+    vector<string> results(4);
+    vector<thread> threads;
+    for (size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([&g, &results, t]() { results[t] = ariel::Algorithms::shortestPath(g, 0, 288); });
+    }
+    for (thread& worker : threads) {
+        worker.join();
+    }
+    for (const string& result : results) {
+        CHECK(result == expected);
+    }
+}
+
+TEST_CASE("Test landmark index rejects negative weights")
+{
+    ariel::Graph g;
+    vector<vector<int>> graph = {{0, -1},
+                                 {1, 0}};
+    g.loadGraph(graph);
+    CHECK_THROWS_AS(ariel::LandmarkIndex(g, 2), invalid_argument);
+}
+
+TEST_CASE("Test shortestPath on a large graph uses an up to date landmark index")
+{
+    // A 300 vertex path 0->1->...->299 plus a long detour edge 0->299
+    ariel::Graph g;
+    vector<vector<int>> graph(300, vector<int>(300, 0));
+    for (size_t i = 0; i + 1 < 300; ++i) {
+        graph[i][i + 1] = 1;
+    }
+    graph[0][299] = 1000;
+    g.loadGraph(graph);
+    string expected = "0";
+    for (size_t i = 1; i < 300; ++i) {
+        expected += "->" + to_string(i);
+    }
+    CHECK(ariel::Algorithms::shortestPath(g, 0, 299) == expected);
+    CHECK(ariel::Algorithms::shortestPath(g, 299, 0) == "There is no path between 299 and 0");
+
+    // Changing the weights must drop the cached index
+    g = g * 2;
+    graph[0][299] = 1;
+    g.loadGraph(graph);
+    CHECK(ariel::Algorithms::shortestPath(g, 0, 299) == "0->299");
+}
+
+TEST_CASE("Test delta-stepping matches Dijkstra")
+{
+    ariel::Graph g;
+    vector<vector<int>> graph = {
+        {0, 4, 1, 0, 0, 0},
+        {0, 0, 0, 1, 0, 0},
+        {0, 2, 0, 8, 0, 0},
+        {0, 0, 0, 0, 3, 0},
+        {0, 0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 1, 0}};
+    g.loadGraph(graph);
+    vector<long long> expected = {0, 3, 1, 4, 7, ariel::ShortestPaths::INF};
+    CHECK(ariel::ShortestPaths::dijkstra(ariel::CSRGraph::fromGraph(g), 0) == expected);
+
+    // Every bucket width and thread count must give the same distances
+    for (long long delta = 1; delta <= 9; delta += 4) {
+        for (unsigned threads = 1; threads <= 4; threads *= 2) {
+            CHECK(ariel::Algorithms::deltaStepping(g, 0, delta, threads) == expected);
+        }
+    }
+    CHECK(ariel::Algorithms::deltaStepping(g, 0) == expected);
+
+    CHECK_THROWS_AS(ariel::Algorithms::deltaStepping(g, 6), invalid_argument);
+    g.loadGraph({{0, -1}, {1, 0}});
+    CHECK_THROWS_AS(ariel::Algorithms::deltaStepping(g, 0), invalid_argument);
+}
+
+TEST_CASE("Test delta-stepping on a weighted grid")
+{
+    vector<vector<int>> graph = gridMatrix(15, 1);
+    for (size_t u = 0; u < graph.size(); ++u) {
+        for (size_t v = 0; v < graph.size(); ++v) {
+            if (graph[u][v] != 0) {
+                graph[u][v] = static_cast<int>((u * 7 + v * 13) % 50) + 1;
+            }
+        }
+    }
+    ariel::Graph g;
+    g.loadGraph(graph);
+    vector<long long> expected = ariel::ShortestPaths::dijkstra(ariel::CSRGraph::fromGraph(g), 17);
+    CHECK(ariel::Algorithms::deltaStepping(g, 17, 10, 3) == expected);
+    CHECK(ariel::Algorithms::deltaStepping(g, 17, 1000, 2) == expected);
+
+    // Weights far wider than the bucket ring (225 vertices) send buckets through the overflow
+    for (size_t u = 0; u < graph.size(); ++u) {
+        for (size_t v = 0; v < graph.size(); ++v) {
+            if (graph[u][v] != 0) {
+                graph[u][v] = static_cast<int>((u * 7919 + v * 104729) % 1000000) + 1;
+            }
+        }
+    }
+    g.loadGraph(graph);
+    expected = ariel::ShortestPaths::dijkstra(ariel::CSRGraph::fromGraph(g), 17);
+    CHECK(ariel::Algorithms::deltaStepping(g, 17, 1, 3) == expected);
+    CHECK(ariel::Algorithms::deltaStepping(g, 17, 5000, 4) == expected);
+}
+
+TEST_CASE("Test worker team rethrows a worker's exception")
+{
+    ariel::WorkerTeam team(4);
+    vector<int> reached(team.size(), 0);
+
+    // Worker 0 is the calling thread
+    CHECK_THROWS_AS(team.run([](unsigned worker) {
+        if (worker == 0) {
+            throw runtime_error("worker 0");
+        }
+    }), runtime_error);
+
+    // A worker that throws before a sync doesn't hold the others at it
+    CHECK_THROWS_AS(team.run([&](unsigned worker) {
+        if (worker == 2) {
+            throw runtime_error("worker 2");
+        }
+        team.sync();
+        reached[worker] = 1;
+        team.sync();
+    }), runtime_error);
+    CHECK(reached == vector<int>{1, 1, 0, 1});
+
+    // The team is still whole afterwards
+    team.run([&](unsigned worker) {
+        team.sync();
+        reached[worker] = 2;
+    });
+    CHECK(reached == vector<int>{2, 2, 2, 2});
+}
+
+TEST_CASE("Test monotone priority queues")
+{
+    ariel::DialQueue dial(10);
+    ariel::RadixHeap radix;
+    long long keys[] = {0, 7, 3, 10, 3};
+    for (size_t i = 0; i < 5; ++i) {
+        dial.push(keys[i], i);
+        radix.push(keys[i], i);
+    }
+    long long expected[] = {0, 3, 3, 7};
+    for (long long key : expected) {
+        CHECK(dial.pop().first == key);
+        CHECK(radix.pop().first == key);
+    }
+    // Keys pushed after a pop only have to be at least the last popped key
+    dial.push(15, 9);
+    radix.push(1000000, 9);
+    CHECK(dial.pop() == make_pair(10LL, size_t(3)));
+    CHECK(dial.pop() == make_pair(15LL, size_t(9)));
+    CHECK(radix.pop() == make_pair(10LL, size_t(3)));
+    CHECK(radix.pop() == make_pair(1000000LL, size_t(9)));
+    CHECK(dial.empty());
+    CHECK(radix.empty());
+    CHECK_THROWS_AS(dial.pop(), out_of_range);
+}
+
+TEST_CASE("Test shortestPath queue backends")
+{
+    ariel::Graph g;
+    vector<vector<int>> graph = {
+        {0, 4, 1, 0, 0},
+        {0, 0, 0, 1, 0},
+        {0, 2, 0, 8, 0},
+        {0, 0, 0, 0, 3},
+        {0, 0, 0, 0, 0}};
+    g.loadGraph(graph);
+    CHECK(g.getMaxWeight() == 8);
+    CHECK(ariel::ShortestPaths::selectBackend(g.getMaxWeight()) == ariel::QueueBackend::Dial);
+    CHECK(ariel::ShortestPaths::selectBackend(1 << 20) == ariel::QueueBackend::RadixHeap);
+
+    ariel::QueueBackend backends[] = {ariel::QueueBackend::Auto, ariel::QueueBackend::BinaryHeap,
+                                      ariel::QueueBackend::Dial, ariel::QueueBackend::RadixHeap};
+    for (ariel::QueueBackend backend : backends) {
+        CHECK(ariel::Algorithms::shortestPath(g, 0, 4, backend) == "0->2->1->3->4");
+        CHECK(ariel::Algorithms::shortestPath(g, 4, 0, backend) == "There is no path between 4 and 0");
+    }
+
+    // The tracked maximum follows the operators
+    ++g;
+    CHECK(g.getMaxWeight() == 9);
+    CHECK(ariel::Algorithms::shortestPath(g, 2, 4, ariel::QueueBackend::Dial) == "2->1->3->4");
+}
+
+// Every (start, end) pair answers with the path Bellman-Ford picks, whatever the backend
+static void checkBellmanFordPaths(const ariel::Graph& g)
+{
+    ariel::QueueBackend backends[] = {ariel::QueueBackend::Auto, ariel::QueueBackend::BinaryHeap,
+                                      ariel::QueueBackend::Dial, ariel::QueueBackend::RadixHeap};
+    auto V = static_cast<size_t>(g.getNumVertices());
+    for (size_t start = 0; start < V; ++start) {
+        for (size_t end = 0; end < V; ++end) {
+            string expected = ariel::Algorithms::shortestPath<int>(g, start, end);
+            for (ariel::QueueBackend backend : backends) {
+                CHECK(ariel::Algorithms::shortestPath(g, start, end, backend) == expected);
+            }
+        }
+    }
+}
+
+TEST_CASE("Test shortestPath backends break ties like Bellman-Ford")
+{
+    ariel::Graph g;
+    g.loadGraph({
+        {0, 0, 0, 0},
+        {1, 0, 0, 0},
+        {0, 1, 0, 1},
+        {1, 0, 0, 0}});
+    CHECK(ariel::Algorithms::shortestPath(g, 2, 0) == "2->3->0");
+    checkBellmanFordPaths(g);
+
+    g.loadGraph({
+        {0, 1, 0, 1},
+        {1, 0, 1, 0},
+        {0, 1, 0, 1},
+        {1, 0, 1, 0}});
+    CHECK(ariel::Algorithms::shortestPath(g, 0, 2) == "0->1->2");
+    checkBellmanFordPaths(g);
+
+    g.loadGraph(gridMatrix(4, 3));
+    checkBellmanFordPaths(g);
+
+    // Weights 1 and 2 on a dense random graph: many paths of equal length
+    mt19937 rng(28);
+    uniform_int_distribution<int> weight(0, 2);
+    vector<vector<int>> matrix(12, vector<int>(12, 0));
+    for (size_t u = 0; u < 12; ++u) {
+        for (size_t v = 0; v < 12; ++v) {
+            matrix[u][v] = u == v ? 0 : weight(rng);
+        }
+    }
+    g.loadGraph(matrix);
+    checkBellmanFordPaths(g);
+
+    // Acyclic with negative weights: the topological order pass
+    g.loadGraph({
+        {0, -1, -1, 0, 0},
+        {0, 0, 0, -1, 0},
+        {0, 0, 0, -1, -2},
+        {0, 0, 0, 0, -1},
+        {0, 0, 0, 0, 0}});
+    checkBellmanFordPaths(g);
+
+    // Large enough for the landmark A* search
+    g.loadGraph(gridMatrix(16, 1));
+    size_t pairs[][2] = {{0, 255}, {255, 0}, {15, 240}, {240, 15}, {17, 238}};
+    for (auto& pair : pairs) {
+        CHECK(ariel::Algorithms::shortestPath(g, pair[0], pair[1]) == ariel::Algorithms::shortestPath<int>(g, pair[0], pair[1]));
+    }
+}
+
+// --------------------- CONNECTIVITY TESTS ---------------------
+
+TEST_CASE("Test disjoint set")
+{
+    ariel::DisjointSet sets(5);
+    CHECK(sets.count() == 5);
+    CHECK(sets.unite(0, 1));
+    CHECK(sets.unite(3, 4));
+    CHECK_FALSE(sets.unite(1, 0));
+    CHECK(sets.find(0) == sets.find(1));
+    CHECK(sets.find(1) != sets.find(3));
+    CHECK(sets.count() == 3);
+}
+
+TEST_CASE("Test connected components labels and sizes")
+{
+    ariel::Graph g;
+    vector<vector<int>> graph = {
+        {0, 1, 1, 0, 0},
+        {1, 0, 1, 0, 0},
+        {1, 1, 0, 1, 0},
+        {0, 0, 1, 0, 0},
+        {0, 0, 0, 0, 0}};
+    g.loadGraph(graph);
+    ariel::Components components = ariel::Algorithms::connectedComponents(g);
+    CHECK(components.count() == 2);
+    CHECK(components.id == vector<size_t>({0, 0, 0, 0, 1}));
+    CHECK(components.sizes == vector<size_t>({4, 1}));
+    CHECK(ariel::Algorithms::isConnected(g) == false);
+
+    // Directed edges join components too (weak connectivity)
+    graph[4][0] = 2;
+    g.loadGraph(graph);
+    CHECK(ariel::Algorithms::connectedComponents(g).count() == 1);
+
+    // The cached labels are dropped when the graph changes
+    ariel::Graph h;
+    h.loadGraph({{0, 1}, {1, 0}});
+    CHECK(ariel::Algorithms::isConnected(h) == true);
+    h * 0; // Scalar multiplication updates the graph in place
+    CHECK(ariel::Algorithms::isConnected(h) == false);
+    CHECK(ariel::Algorithms::connectedComponents(h).sizes == vector<size_t>({1, 1}));
+}
+
+TEST_CASE("Test parallel components match the sequential labels")
+{
+    // Three directed chains and an isolated vertex, with extra chords inside the first chain
+    size_t V = 200;
+    vector<vector<int>> graph(V, vector<int>(V, 0));
+    for (size_t v = 1; v < 199; ++v) {
+        if (v % 3 == 0) {
+            graph[v][v - 3 < v ? v - 3 : 0] = 1;
+        } else if (v >= 3) {
+            graph[v - 3][v] = 1;
+        }
+    }
+    for (size_t v = 6; v < 199; v += 9) {
+        graph[v][0] = 1;
+    }
+    ariel::Graph g;
+    g.loadGraph(graph);
+    ariel::Components expected = ariel::Components::fromGraph(g);
+    CHECK(expected.count() == 4);
+    for (unsigned threads = 1; threads <= 4; ++threads) {
+        ariel::Components components = ariel::Components::parallelFromGraph(g, threads);
+        CHECK(components.id == expected.id);
+        CHECK(components.sizes == expected.sizes);
+    }
+}
+
+TEST_CASE("Test concurrent component queries share one labeling")
+{
+    // Two undirected chains of 100 vertices
+    size_t V = 200;
+    vector<vector<int>> graph(V, vector<int>(V, 0));
+    for (size_t v = 1; v < V; ++v) {
+        if (v != 100) {
+            graph[v - 1][v] = graph[v][v - 1] = 1;
+        }
+    }
+    ariel::Graph g;
+    g.loadGraph(graph);
+    vector<size_t> counts(4);
+    vector<int> connected(4);
+    vector<thread> threads;
+    for (size_t t = 0; t < counts.size(); ++t) {
+        threads.emplace_back([&g, &counts, &connected, t]() {
+            connected[t] = ariel::Algorithms::isConnected(g);
+            counts[t] = ariel::Algorithms::connectedComponents(g).count();
+        });
+    }
+    for (thread& worker : threads) {
+        worker.join();
+    }
+    CHECK(counts == vector<size_t>(4, 2));
+    CHECK(connected == vector<int>(4, 0));
+}
+
+TEST_CASE("Test strongly connected components")
+{
+    ariel::Graph g;
+    // The demo graph is a directed 3-cycle
+    g.loadGraph({{0, 1, 0},
+                 {0, 0, 1},
+                 {1, 0, 0}});
+    CHECK(ariel::Algorithms::isStronglyConnected(g) == true);
+    CHECK(ariel::Algorithms::isWeaklyConnected(g) == true);
+    CHECK(ariel::Algorithms::stronglyConnectedComponents(g).count() == 1);
+
+    // A directed path: every vertex is its own component, numbered in topological order
+    g.loadGraph({{0, 1, 0, 0},
+                 {0, 0, 1, 0},
+                 {0, 0, 0, 1},
+                 {0, 0, 0, 0}});
+    CHECK(ariel::Algorithms::isStronglyConnected(g) == false);
+    CHECK(ariel::Algorithms::isWeaklyConnected(g) == true);
+    ariel::StrongComponents scc = ariel::Algorithms::stronglyConnectedComponents(g);
+    CHECK(scc.id == vector<size_t>({0, 1, 2, 3}));
+    CHECK(scc.condensation.targets == vector<size_t>({1, 2, 3}));
+}
+
+TEST_CASE("Test concurrent strong component queries share one labeling")
+{
+    // A directed cycle through every vertex but the last, which only points into it
+    size_t V = 100;
+    vector<vector<int>> graph(V, vector<int>(V, 0));
+    for (size_t v = 0; v + 1 < V; ++v) {
+        graph[v][(v + 1) % (V - 1)] = 1;
+    }
+    graph[V - 1][0] = 1;
+    ariel::Graph g;
+    g.loadGraph(graph);
+    vector<size_t> counts(4);
+    vector<int> strong(4);
+    vector<thread> threads;
+    for (size_t t = 0; t < counts.size(); ++t) {
+        threads.emplace_back([&g, &counts, &strong, t]() {
+            counts[t] = ariel::Algorithms::stronglyConnectedComponents(g).count();
+            strong[t] = ariel::Algorithms::isStronglyConnected(g);
+        });
+    }
+    for (thread& worker : threads) {
+        worker.join();
+    }
+    CHECK(counts == vector<size_t>(4, 2));
+    CHECK(strong == vector<int>(4, 0));
+}
+
+TEST_CASE("Test condensation DAG")
+{
+    ariel::Graph g;
+    // Two 2-cycles {0,1} and {2,3} joined by two edges 1->2 (5) and 0->3 (2), plus an isolated vertex 4
+    g.loadGraph({{0, 1, 0, 2, 0},
+                 {1, 0, 5, 0, 0},
+                 {0, 0, 0, 1, 0},
+                 {0, 0, 1, 0, 0},
+                 {0, 0, 0, 0, 0}});
+    ariel::StrongComponents scc = ariel::Algorithms::stronglyConnectedComponents(g);
+    CHECK(scc.count() == 3);
+    CHECK(scc.id[0] == scc.id[1]);
+    CHECK(scc.id[2] == scc.id[3]);
+    CHECK(scc.id[0] < scc.id[2]);
+    CHECK(scc.sizes[scc.id[0]] == 2);
+    CHECK(scc.sizes[scc.id[4]] == 1);
+
+    // The two parallel edges collapse into one with the lighter weight
+    const ariel::CSRGraph& dag = scc.condensation;
+    CHECK(dag.numEdges() == 1);
+    size_t from = scc.id[0];
+    CHECK(dag.offsets[from + 1] - dag.offsets[from] == 1);
+    CHECK(dag.targets[dag.offsets[from]] == scc.id[2]);
+    CHECK(dag.weights[dag.offsets[from]] == 2);
+    CHECK(ariel::Algorithms::isWeaklyConnected(g) == false);
+}
+
+TEST_CASE("Test incremental connectivity and parity")
+{
+    ariel::IncrementalConnectivity tracker(4);
+    CHECK(tracker.componentCount() == 4);
+    tracker.addEdge(0, 1);
+    tracker.addEdge(2, 3);
+    tracker.addEdge(1, 2);
+    CHECK(tracker.isConnected());
+    CHECK(tracker.isBipartite());
+    CHECK(tracker.color(0) != tracker.color(1));
+    CHECK(tracker.color(0) == tracker.color(2));
+    tracker.addEdge(3, 0); // Even cycle 0-1-2-3
+    CHECK(tracker.isBipartite());
+    tracker.addEdge(0, 2); // Odd cycle 0-1-2
+    CHECK_FALSE(tracker.isBipartite());
+    CHECK(tracker.addVertex() == 4);
+    CHECK_FALSE(tracker.isConnected());
+    CHECK_FALSE(tracker.connected(4, 0));
+}
+
+TEST_CASE("Test graph built edge by edge")
+{
+    ariel::Graph g;
+    g.loadGraph(vector<vector<int>>(5, vector<int>(5, 0)));
+    CHECK(g.connectivity().componentCount() == 5);
+
+    // Undirected path 0-1-2-3-4, checked after every batch
+    for (size_t v = 0; v + 1 < 5; ++v) {
+        g.addEdge(v, v + 1, 1);
+        g.addEdge(v + 1, v, 1);
+        CHECK(g.connectivity().componentCount() == 4 - v);
+    }
+    CHECK(g.getNumEdges() == 8);
+    CHECK(g.isSymmetric());
+    CHECK(ariel::Algorithms::isConnected(g) == true);
+    CHECK(ariel::Algorithms::isBipartite(g) == "The graph is bipartite: A={0, 2, 4}, B={1, 3}.");
+
+    // One directed edge closes the odd cycle 0-1-2
+    g.addEdge(0, 2, 3);
+    CHECK(g.isSymmetric() == false);
+    CHECK(g.getMaxWeight() == 3);
+    CHECK(g.connectivity().isBipartite() == false);
+    CHECK(ariel::Algorithms::isBipartite(g) == "The graph isn't bipartite.");
+
+    // Copies don't see each other's insertions
+    ariel::Graph h;
+    h.loadGraph(vector<vector<int>>(3, vector<int>(3, 0)));
+    h.connectivity();
+    ariel::Graph hCopy = h;
+    h.addEdge(0, 1, 1);
+    CHECK(h.connectivity().componentCount() == 2);
+    CHECK(hCopy.connectivity().componentCount() == 3);
+
+    CHECK_THROWS_AS(g.addEdge(1, 1, 1), invalid_argument);
+    CHECK_THROWS_AS(g.addEdge(0, 5, 1), invalid_argument);
+    CHECK_THROWS_AS(g.addEdge(0, 1, 0), invalid_argument);
+}
+
+TEST_CASE("Test concurrent connectivity queries share one tracker")
+{
+    // Undirected path 0-1-...-99
+    size_t V = 100;
+    vector<vector<int>> graph(V, vector<int>(V, 0));
+    for (size_t v = 1; v < V; ++v) {
+        graph[v - 1][v] = graph[v][v - 1] = 1;
+    }
+    ariel::Graph g;
+    g.loadGraph(graph);
+    vector<int> results(4);
+    vector<thread> threads;
+    for (size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([&g, &results, t]() {
+            const ariel::IncrementalConnectivity& tracker = g.connectivity();
+            results[t] = tracker.componentCount() == 1 && tracker.connected(0, 99) && tracker.color(99) != tracker.color(0);
+        });
+    }
+    for (thread& worker : threads) {
+        worker.join();
+    }
+    CHECK(results == vector<int>(4, 1));
+    CHECK(&g.connectivity() == &g.connectivity());
+}
+
+TEST_CASE("Test edge and vertex mutation")
+{
+    ariel::Graph g;
+    vector<vector<int>> graph = {
+        {0, 1, 0},
+        {1, 0, 1},
+        {0, 1, 0}};
+    g.loadGraph(graph);
+
+    g.setWeight(0, 1, 5);
+    CHECK(g.getWeight(0, 1) == 5);
+    CHECK(g.getMaxWeight() == 5);
+    CHECK(g.isSymmetric() == false);
+    g.setWeight(0, 1, 1);
+    CHECK(g.getMaxWeight() == 1);
+    CHECK(g.isSymmetric() == true);
+
+    g.removeEdge(1, 2);
+    g.removeEdge(2, 1);
+    CHECK(g.getNumEdges() == 2);
+    CHECK(ariel::Algorithms::isConnected(g) == false);
+
+    CHECK(g.addVertex() == 3);
+    CHECK(g.getNumVertices() == 4);
+    g.addEdges({{2, 3, -2}, {3, 2, -2}, {1, 3, 4}, {3, 1, 4}});
+    CHECK(g.getNumEdges() == 6);
+    CHECK(g.hasNegativeWeights());
+    CHECK(g.getMaxWeight() == 4);
+    CHECK(ariel::Algorithms::isConnected(g) == true);
+
+    // Vertex 3 moves into slot 1
+    g.removeVertex(1);
+    CHECK(g.getNumVertices() == 3);
+    CHECK(g.getNumEdges() == 2);
+    CHECK(g.getWeight(1, 2) == -2);
+    CHECK(g.getWeight(2, 1) == -2);
+    CHECK(g.getWeight(0, 1) == 0);
+    CHECK(g.getMaxWeight() == 0);
+    CHECK(ariel::Algorithms::isConnected(g) == false);
+
+    // Same result as building the matrix from scratch
+    ariel::Graph expected;
+    expected.loadGraph({{0, 0, 0}, {0, 0, -2}, {0, -2, 0}});
+    CHECK(g == expected);
+
+    // A bad edge anywhere in a batch leaves the graph untouched
+    CHECK_THROWS_AS(g.addEdges({{0, 1, 3}, {0, 3, 3}}), invalid_argument);
+    CHECK(g.getWeight(0, 1) == 0);
+    CHECK_THROWS_AS(g.removeEdge(0, 1), invalid_argument);
+    CHECK_THROWS_AS(g.setWeight(0, 1, 2), invalid_argument);
+    CHECK_THROWS_AS(g.setWeight(1, 2, 0), invalid_argument);
+    CHECK_THROWS_AS(g.removeVertex(3), invalid_argument);
+
+    ariel::Graph single;
+    single.loadGraph({{0}});
+    CHECK_THROWS_AS(single.removeVertex(0), invalid_argument);
+}
+
+TEST_CASE("Test maximum weight follows repeated removals of the heaviest edge")
+{
+    // Edge 0->v weighs v, removed from the heaviest down, then lowered one by one
+    size_t V = 50;
+    vector<vector<int>> graph(V, vector<int>(V, 0));
+    for (size_t v = 1; v < V; ++v) {
+        graph[0][v] = static_cast<int>(v);
+    }
+    ariel::Graph g;
+    g.loadGraph(graph);
+    for (size_t v = V - 1; v > 25; --v) {
+        g.removeEdge(0, v);
+        CHECK(g.getMaxWeight() == static_cast<int>(v - 1));
+    }
+    g.setWeight(0, 25, 3);
+    CHECK(g.getMaxWeight() == 24);
+    g.setWeight(0, 1, 30);
+    CHECK(g.getMaxWeight() == 30);
+    g.addEdge(1, 0, 30);
+    g.removeEdge(0, 1);
+    CHECK(g.getMaxWeight() == 30);
+    g.removeEdge(1, 0);
+    CHECK(g.getMaxWeight() == 24);
+    for (size_t v = 2; v <= 25; ++v) {
+        g.removeEdge(0, v);
+    }
+    CHECK(g.getNumEdges() == 0);
+    CHECK(g.getMaxWeight() == 0);
+
+    // Reloading starts counting again from the new matrix
+    g.loadGraph({{0, 2}, {7, 0}});
+    CHECK(g.getMaxWeight() == 7);
+    g.removeEdge(1, 0);
+    CHECK(g.getMaxWeight() == 2);
+}
+
+// --------------------- SPANNING TREE TESTS ---------------------
+
+TEST_CASE("Test minimum spanning tree")
+{
+    ariel::Graph g;
+    vector<vector<int>> graph = {
+        {0, 4, 1, 0, 0},
+        {4, 0, 2, 5, 0},
+        {1, 2, 0, 8, 0},
+        {0, 5, 8, 0, 3},
+        {0, 0, 0, 3, 0}};
+    g.loadGraph(graph);
+
+    ariel::SpanningTree prim = ariel::SpanningTree::prim(g);
+    ariel::SpanningTree kruskal = ariel::SpanningTree::kruskal(g, 3);
+    CHECK(prim.totalWeight == 11);
+    CHECK(kruskal.totalWeight == 11);
+    CHECK(prim.isSpanning(5));
+    CHECK(kruskal.isSpanning(5));
+    CHECK(kruskal.edges.front().from == 0);
+    CHECK(kruskal.edges.front().to == 2);
+    CHECK(ariel::Algorithms::minimumSpanningTree(g).totalWeight == 11);
+
+    // Directions are ignored and the lighter one wins; negative weights are fine
+    ariel::Graph directed;
+    directed.loadGraph({{0, 7, 0}, {-1, 0, 0}, {0, 2, 0}});
+    CHECK(ariel::Algorithms::minimumSpanningTree(directed, ariel::MSTMethod::Prim).totalWeight == 1);
+    CHECK(ariel::Algorithms::minimumSpanningTree(directed, ariel::MSTMethod::Kruskal).totalWeight == 1);
+
+    // Disconnected graphs get a spanning forest
+    ariel::Graph forest;
+    forest.loadGraph({{0, 3, 0, 0}, {3, 0, 0, 0}, {0, 0, 0, 6}, {0, 0, 6, 0}});
+    ariel::SpanningTree tree = ariel::Algorithms::minimumSpanningTree(forest, ariel::MSTMethod::Prim);
+    CHECK(tree.edges.size() == 2);
+    CHECK(tree.isSpanning(4) == false);
+    CHECK(tree.totalWeight == 9);
+    CHECK(ariel::Algorithms::minimumSpanningTree(forest, ariel::MSTMethod::Kruskal).totalWeight == 9);
+}
+
+TEST_CASE("Test Prim and Kruskal agree on random graphs")
+{
+    mt19937 rng(11);
+    uniform_int_distribution<int> weight(1, 20);
+    bernoulli_distribution present(0.3);
+    for (int round = 0; round < 5; ++round) {
+        size_t V = 40;
+        vector<vector<int>> matrix(V, vector<int>(V, 0));
+        for (size_t u = 0; u < V; ++u) {
+            for (size_t v = u + 1; v < V; ++v) {
+                if (present(rng)) {
+                    matrix[u][v] = matrix[v][u] = weight(rng);
+                }
+            }
+        }
+        ariel::Graph g;
+        g.loadGraph(matrix);
+        long long expected = ariel::SpanningTree::prim(g).totalWeight;
+        CHECK(ariel::SpanningTree::kruskal(g, 1).totalWeight == expected);
+        CHECK(ariel::SpanningTree::kruskal(g, 4).totalWeight == expected);
+    }
+}
+
+// --------------------- FLOW TESTS ---------------------
+
+TEST_CASE("Test push-relabel maximum flow")
+{
+    // Classic CLRS network, maximum flow 23
+    ariel::Graph g;
+    vector<vector<int>> graph = {
+        {0, 16, 13, 0, 0, 0},
+        {0, 0, 10, 12, 0, 0},
+        {0, 4, 0, 0, 14, 0},
+        {0, 0, 9, 0, 0, 20},
+        {0, 0, 0, 7, 0, 4},
+        {0, 0, 0, 0, 0, 0}};
+    g.loadGraph(graph);
+
+    ariel::MaxFlow flow = ariel::Algorithms::maxFlow(g, 0, 5);
+    CHECK(flow.value == 23);
+    CHECK(flow.sourceSide[0] == true);
+    CHECK(flow.sourceSide[5] == false);
+    long long cutCapacity = 0;
+    for (const ariel::Edge& edge : flow.cutEdges) {
+        CHECK(flow.sourceSide[edge.from]);
+        CHECK_FALSE(flow.sourceSide[edge.to]);
+        cutCapacity += edge.weight;
+    }
+    CHECK(cutCapacity == 23);
+
+    // Reversed direction: nothing flows back into vertex 0
+    CHECK(ariel::Algorithms::maxFlow(g, 5, 0).value == 0);
+
+    // Disconnected sink
+    ariel::Graph split;
+    split.loadGraph({{0, 5, 0}, {5, 0, 0}, {0, 0, 0}});
+    ariel::MaxFlow none = ariel::Algorithms::maxFlow(split, 0, 2);
+    CHECK(none.value == 0);
+    CHECK(none.cutEdges.empty());
+
+    CHECK_THROWS_AS(ariel::Algorithms::maxFlow(g, 0, 0), invalid_argument);
+    CHECK_THROWS_AS(ariel::Algorithms::maxFlow(g, 0, 6), invalid_argument);
+    ariel::Graph negative;
+    negative.loadGraph({{0, -1}, {1, 0}});
+    CHECK_THROWS_AS(ariel::Algorithms::maxFlow(negative, 0, 1), invalid_argument);
+}
+
+TEST_CASE("Test maximum flow equals minimum cut on random graphs")
+{
+    mt19937 rng(21);
+    uniform_int_distribution<int> capacity(1, 9);
+    bernoulli_distribution present(0.2);
+    for (int round = 0; round < 10; ++round) {
+        size_t V = 30;
+        vector<vector<int>> matrix(V, vector<int>(V, 0));
+        for (size_t u = 0; u < V; ++u) {
+            for (size_t v = 0; v < V; ++v) {
+                if (u != v && present(rng)) {
+                    matrix[u][v] = capacity(rng);
+                }
+            }
+        }
+        ariel::Graph g;
+        g.loadGraph(matrix);
+        ariel::MaxFlow flow = ariel::Algorithms::maxFlow(g, 0, V - 1);
+        long long cutCapacity = 0;
+        for (const ariel::Edge& edge : flow.cutEdges) {
+            cutCapacity += edge.weight;
+        }
+        CHECK(flow.value == cutCapacity);
+        CHECK(flow.sourceSide[0]);
+        CHECK_FALSE(flow.sourceSide[V - 1]);
+    }
+}
+
+// --------------------- DAG TESTS ---------------------
+
+TEST_CASE("Test topological order")
+{
+    ariel::Graph g;
+    vector<vector<int>> graph = {
+        {0, 0, 1, 0},
+        {1, 0, 0, 1},
+        {0, 0, 0, 1},
+        {0, 0, 0, 0}};
+    g.loadGraph(graph);
+    vector<size_t> order = ariel::Algorithms::topologicalOrder(g);
+    CHECK(order == vector<size_t>({1, 0, 2, 3}));
+
+    g.addEdge(3, 1, 1);
+    CHECK_THROWS_AS(ariel::Algorithms::topologicalOrder(g), invalid_argument);
+    ariel::TopologicalOrder partial = ariel::TopologicalOrder::fromGraph(g);
+    CHECK(partial.acyclic == false);
+    CHECK(partial.order.empty());
+}
+
+TEST_CASE("Test DAG shortest paths")
+{
+    // Negative weights without a cycle skip Bellman-Ford
+    ariel::Graph g;
+    vector<vector<int>> graph = {
+        {0, 6, 3, 0, 0},
+        {0, 0, 0, -4, 0},
+        {0, 2, 0, 7, 0},
+        {0, 0, 0, 0, -1},
+        {0, 0, 0, 0, 0}};
+    g.loadGraph(graph);
+    CHECK(ariel::Algorithms::shortestPath(g, 0, 4) == "0->2->1->3->4");
+    CHECK(ariel::Algorithms::shortestPath(g, 4, 0) == "There is no path between 4 and 0");
+
+    vector<long long> dist;
+    vector<size_t> prev;
+    ariel::ShortestPaths::dagShortestPaths(ariel::CSRGraph::fromGraph(g), ariel::Algorithms::topologicalOrder(g), 0, dist, prev);
+    CHECK(dist == vector<long long>({0, 5, 3, 1, 0}));
+
+    // Once the order is known, non-negative DAGs use it too
+    ariel::Graph positive;
+    positive.loadGraph({{0, 1, 4}, {0, 0, 1}, {0, 0, 0}});
+    ariel::Algorithms::topologicalOrder(positive);
+    CHECK(ariel::Algorithms::shortestPath(positive, 0, 2) == "0->1->2");
+
+    // A cycle sends negative weights back to Bellman-Ford
+    g.addEdge(4, 0, -1);
+    CHECK(ariel::Algorithms::shortestPath(g, 0, 4) == "Negative cycle detected");
+}
+
+TEST_CASE("Test concurrent DAG queries share one topological order")
+{
+    // Chain 0->1->...->59 with negative weights, so shortestPath needs the order
+    size_t V = 60;
+    vector<vector<int>> graph(V, vector<int>(V, 0));
+    for (size_t v = 1; v < V; ++v) {
+        graph[v - 1][v] = -1;
+    }
+    ariel::Graph g;
+    g.loadGraph(graph);
+    vector<string> paths(4);
+    vector<size_t> firsts(4);
+    vector<thread> threads;
+    for (size_t t = 0; t < paths.size(); ++t) {
+        threads.emplace_back([&g, &paths, &firsts, t]() {
+            paths[t] = ariel::Algorithms::shortestPath(g, 57, 59);
+            firsts[t] = ariel::Algorithms::topologicalOrder(g)[0];
+        });
+    }
+    for (thread& worker : threads) {
+        worker.join();
+    }
+    CHECK(paths == vector<string>(4, "57->58->59"));
+    CHECK(firsts == vector<size_t>(4, 0));
+}
+
+TEST_CASE("Test transitive closure")
+{
+    // 0 <-> 1 -> 2 -> 3, 4 isolated
+    ariel::Graph g;
+    vector<vector<int>> graph = {
+        {0, 1, 0, 0, 0},
+        {1, 0, 1, 0, 0},
+        {0, 0, 0, 1, 0},
+        {0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0}};
+    g.loadGraph(graph);
+
+    ariel::TransitiveClosure condensed(g, ariel::ClosureMethod::Condensation);
+    ariel::TransitiveClosure warshall(g, ariel::ClosureMethod::Warshall);
+    CHECK(condensed.getNumRows() == 4);
+    CHECK(warshall.getNumRows() == 5);
+    CHECK(condensed.memoryBytes() < warshall.memoryBytes());
+    for (size_t u = 0; u < 5; ++u) {
+        for (size_t v = 0; v < 5; ++v) {
+            CHECK(condensed.reachable(u, v) == warshall.reachable(u, v));
+        }
+    }
+    CHECK(condensed.reachable(1, 0));
+    CHECK(condensed.reachable(0, 3));
+    CHECK_FALSE(condensed.reachable(3, 2));
+    CHECK(condensed.reachable(4, 4));
+    CHECK_FALSE(condensed.reachable(4, 0));
+    CHECK(condensed.countReachable(0) == 4);
+    CHECK(warshall.countReachable(2) == 2);
+    CHECK_THROWS_AS(condensed.reachable(0, 5), invalid_argument);
+
+    CHECK(ariel::Algorithms::isReachable(g, 0, 3));
+    g.removeEdge(1, 2);
+    CHECK_FALSE(ariel::Algorithms::isReachable(g, 0, 3));
+}
+
+TEST_CASE("Test concurrent reachability queries share one closure")
+{
+    // Directed chain 0->1->...->149
+    size_t V = 150;
+    vector<vector<int>> graph(V, vector<int>(V, 0));
+    for (size_t v = 1; v < V; ++v) {
+        graph[v - 1][v] = 1;
+    }
+    ariel::Graph g;
+    g.loadGraph(graph);
+    vector<int> results(4);
+    vector<thread> threads;
+    for (size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([&g, &results, t]() {
+            results[t] = ariel::Algorithms::isReachable(g, t, 149) && !ariel::Algorithms::isReachable(g, 149, t);
+        });
+    }
+    for (thread& worker : threads) {
+        worker.join();
+    }
+    CHECK(results == vector<int>(4, 1));
+    CHECK(&ariel::Algorithms::transitiveClosure(g) == &ariel::Algorithms::transitiveClosure(g));
+}
+
+TEST_CASE("Test transitive closure against BFS on random graphs")
+{
+    mt19937 rng(37);
+    bernoulli_distribution present(0.03);
+    size_t V = 150; // More than two words per row
+    vector<vector<int>> matrix(V, vector<int>(V, 0));
+    for (size_t u = 0; u < V; ++u) {
+        for (size_t v = 0; v < V; ++v) {
+            if (u != v && present(rng)) {
+                matrix[u][v] = 1;
+            }
+        }
+    }
+    ariel::Graph g;
+    g.loadGraph(matrix);
+    ariel::TransitiveClosure condensed(g);
+    ariel::TransitiveClosure warshall(g, ariel::ClosureMethod::Warshall);
+    bool allMatch = true;
+    for (size_t source = 0; source < V; ++source) {
+        vector<bool> seen(V, false);
+        vector<size_t> queue(1, source);
+        seen[source] = true;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            for (size_t v = 0; v < V; ++v) {
+                if (matrix[queue[head]][v] != 0 && !seen[v]) {
+                    seen[v] = true;
+                    queue.push_back(v);
+                }
+            }
+        }
+        for (size_t v = 0; v < V; ++v) {
+            allMatch = allMatch && condensed.reachable(source, v) == seen[v] && warshall.reachable(source, v) == seen[v];
+        }
+        allMatch = allMatch && condensed.countReachable(source) == queue.size();
+    }
+    CHECK(allMatch);
+}
+
+// --------------------- MATRIX PRODUCT TESTS ---------------------
+
+TEST_CASE("Test semiring matrix products")
+{
+    // 0 -> 1 -> 2 -> 3 with a shortcut 0 -> 2, and a narrow 1 -> 3
+    ariel::Graph g;
+    vector<vector<int>> graph = {
+        {0, 2, 9, 0},
+        {0, 0, 3, 1},
+        {0, 0, 0, 4},
+        {0, 0, 0, 0}};
+    g.loadGraph(graph);
+
+    // Plus-times: weighted 2-walks
+    ariel::SemiringMatrix<ariel::PlusTimes> a = ariel::SemiringMatrix<ariel::PlusTimes>::fromGraph(g);
+    ariel::SemiringMatrix<ariel::PlusTimes> a2 = a * a;
+    CHECK(a2(0, 2) == 6);
+    CHECK(a2(0, 3) == 2 + 36);
+    CHECK(a2(1, 3) == 12);
+
+    // Min-plus: squaring the reflexive matrix doubles the walk length covered
+    ariel::SemiringMatrix<ariel::MinPlus> d = ariel::SemiringMatrix<ariel::MinPlus>::fromGraph(g, true);
+    ariel::SemiringMatrix<ariel::MinPlus> d4 = (d * d) * (d * d);
+    CHECK(d4(0, 3) == 3);
+    CHECK(d4(0, 2) == 5);
+    CHECK(d4(3, 0) == ariel::MinPlus().zero());
+
+    // Or-and: reachability within two steps
+    ariel::SemiringMatrix<ariel::OrAnd> r = ariel::SemiringMatrix<ariel::OrAnd>::fromGraph(g, true);
+    ariel::SemiringMatrix<ariel::OrAnd> r2 = r * r;
+    CHECK(r2(0, 3) == 1);
+    CHECK(r2(2, 1) == 0);
+    CHECK(r2(2, 2) == 1);
+
+    // Max-min: widest 2-walk from 0 to 3 is 0->2->3 with bottleneck 4
+    ariel::SemiringMatrix<ariel::MaxMin> w = ariel::SemiringMatrix<ariel::MaxMin>::fromGraph(g);
+    CHECK((w * w)(0, 3) == 4);
+
+    ariel::SemiringMatrix<ariel::OrAnd> small(2);
+    CHECK_THROWS_AS(small * r, invalid_argument);
+}
+
+TEST_CASE("Test blocked kernel matches the naive product")
+{
+    mt19937 rng(38);
+    uniform_int_distribution<int> weight(-5, 5);
+    size_t V = 150; // Partial tiles on every side
+    vector<vector<int>> left(V, vector<int>(V, 0));
+    vector<vector<int>> right(V, vector<int>(V, 0));
+    for (size_t i = 0; i < V; ++i) {
+        for (size_t j = 0; j < V; ++j) {
+            if (i != j) {
+                left[i][j] = weight(rng);
+                right[i][j] = weight(rng);
+            }
+        }
+    }
+    ariel::Graph a;
+    ariel::Graph b;
+    a.loadGraph(left);
+    b.loadGraph(right);
+    ariel::Graph product = a * b;
+    ariel::SemiringMatrix<ariel::PlusTimes> threaded =
+        ariel::SemiringMatrix<ariel::PlusTimes>::fromGraph(a).multiply(ariel::SemiringMatrix<ariel::PlusTimes>::fromGraph(b), 3);
+    bool allMatch = true;
+    for (size_t i = 0; i < V; ++i) {
+        for (size_t j = 0; j < V; ++j) {
+            int expected = 0;
+            for (size_t k = 0; k < V; ++k) {
+                expected += left[i][k] * right[k][j];
+            }
+            allMatch = allMatch && threaded(i, j) == expected;
+            allMatch = allMatch && product.getWeight(i, j) == (i == j ? 0 : expected);
+        }
+    }
+    CHECK(allMatch);
+}
+
+TEST_CASE("Test graph powers and walk counting")
+{
+    // Triangle: closed walks of length k from a vertex number (2^k + 2(-1)^k) / 3
+    ariel::Graph triangle;
+    triangle.loadGraph({{0, 1, 1}, {1, 0, 1}, {1, 1, 0}});
+    ariel::SemiringMatrix<ariel::PlusTimes> a3 = ariel::Algorithms::pow(triangle, 3);
+    CHECK(a3(0, 0) == 2);
+    CHECK(a3(0, 1) == 3);
+    CHECK(ariel::Algorithms::pow(triangle, 3, false)(0, 0) == 0);
+    CHECK(ariel::Algorithms::pow(triangle, 40)(1, 1) == ((1LL << 40) + 2) / 3);
+    CHECK(ariel::Algorithms::pow(triangle, 0)(2, 2) == 1);
+    CHECK(ariel::Algorithms::pow(triangle, 0)(2, 1) == 0);
+
+    // Squaring agrees with operator* where the diagonal doesn't matter
+    ariel::Graph product = triangle * triangle;
+    CHECK(ariel::Algorithms::pow(triangle, 2, false)(0, 1) == product.getWeight(0, 1));
+
+    // Closed walks of 1000 edges at vertex 0 of a weighted 2-cycle weigh 2^500, taken mod 1e9+7
+    ariel::Graph pair;
+    pair.loadGraph({{0, 2}, {1, 0}});
+    ariel::SemiringMatrix<ariel::ModPlusTimes> big = ariel::Algorithms::powMod(pair, 1000, 1000000007);
+    long long expected = 1;
+    for (int i = 0; i < 500; ++i) {
+        expected = expected * 2 % 1000000007;
+    }
+    CHECK(big(0, 0) == expected);
+    CHECK(big(0, 1) == 0);
+    CHECK(ariel::Algorithms::powMod(pair, 3, 7)(0, 1) == 4);
+    CHECK_THROWS_AS(ariel::Algorithms::powMod(pair, 3, 0), invalid_argument);
+
+    // Generic pow over another semiring: shortest walks of exactly 3 edges
+    ariel::SemiringMatrix<ariel::MinPlus> d3 = ariel::pow(ariel::SemiringMatrix<ariel::MinPlus>::fromGraph(pair), 3);
+    CHECK(d3(0, 1) == 5);
+}
+
+TEST_CASE("Test sparse matrix product")
+{
+    ariel::Graph a;
+    ariel::Graph b;
+    a.loadGraph({{0, 2, 0}, {0, 0, 0}, {1, 0, 0}});
+    b.loadGraph({{0, 0, 3}, {0, 0, 4}, {0, -8, 0}});
+    ariel::SparseProduct product = ariel::SparseProduct::multiply(ariel::CSRGraph::fromGraph(a), ariel::CSRGraph::fromGraph(b));
+    CHECK(product.numNonZeros() == 2);
+    CHECK(product.offsets == vector<size_t>({0, 1, 1, 2}));
+    CHECK(product.columns == vector<size_t>({2, 2}));
+    CHECK(product.values == vector<long long>({8, 3}));
+
+    // Terms that cancel leave no entry
+    ariel::Graph c;
+    c.loadGraph({{0, 1, 1}, {0, 0, 0}, {0, 0, 0}});
+    ariel::Graph d;
+    d.loadGraph({{0, 0, 0}, {5, 0, 0}, {-5, 0, 0}});
+    CHECK(ariel::SparseProduct::multiply(ariel::CSRGraph::fromGraph(c), ariel::CSRGraph::fromGraph(d)).numNonZeros() == 0);
+}
+
+TEST_CASE("Test operator* on sparse graphs matches the dense kernel")
+{
+    mt19937 rng(40);
+    uniform_int_distribution<int> magnitude(1, 3);
+    bernoulli_distribution negative(0.5);
+    bernoulli_distribution present(0.02);
+    auto weight = [&]() { return negative(rng) ? -magnitude(rng) : magnitude(rng); };
+    size_t V = 200;
+    vector<vector<int>> left(V, vector<int>(V, 0));
+    vector<vector<int>> right(V, vector<int>(V, 0));
+    for (size_t i = 0; i < V; ++i) {
+        for (size_t j = 0; j < V; ++j) {
+            if (i != j && present(rng)) {
+                left[i][j] = weight();
+            }
+            if (i != j && present(rng)) {
+                right[i][j] = weight();
+            }
+        }
+    }
+    ariel::Graph a;
+    ariel::Graph b;
+    a.loadGraph(left);
+    b.loadGraph(right);
+    ariel::Graph product = a * b;
+    ariel::SemiringMatrix<ariel::PlusTimes> dense =
+        ariel::SemiringMatrix<ariel::PlusTimes>::fromGraph(a) * ariel::SemiringMatrix<ariel::PlusTimes>::fromGraph(b);
+    ariel::SparseProduct threaded = ariel::SparseProduct::multiply(ariel::CSRGraph::fromGraph(a), ariel::CSRGraph::fromGraph(b), 3);
+    bool allMatch = true;
+    size_t nonZeros = 0;
+    for (size_t i = 0; i < V; ++i) {
+        for (size_t j = 0; j < V; ++j) {
+            allMatch = allMatch && product.getWeight(i, j) == (i == j ? 0 : dense(i, j));
+            nonZeros += dense(i, j) != 0 ? 1u : 0u;
+        }
+        for (size_t e = threaded.offsets[i]; e < threaded.offsets[i + 1]; ++e) {
+            allMatch = allMatch && threaded.values[e] == dense(i, threaded.columns[e]);
+        }
+    }
+    CHECK(allMatch);
+    CHECK(threaded.numNonZeros() == nonZeros);
+}
+
+TEST_CASE("Test Strassen-Winograd multiplication")
+{
+    mt19937 rng(41);
+    uniform_int_distribution<int> weight(-1000, 1000);
+    const size_t sizes[] = {5, 64, 100, 300};
+    for (size_t n : sizes) {
+        vector<long long> a(n * n), b(n * n), expected(n * n, 0), result(n * n, -1);
+        for (size_t i = 0; i < n * n; ++i) {
+            a[i] = weight(rng);
+            b[i] = weight(rng);
+        }
+        ariel::semiringMultiply(ariel::PlusTimes(), n, a.data(), b.data(), expected.data(), 1);
+        ariel::Strassen::multiply(n, a.data(), b.data(), result.data(), 16, 2);
+        CHECK(result == expected);
+    }
+
+    // Products of large ints stay exact in the 64-bit intermediates
+    vector<long long> big(4 * 4, 1000000000);
+    vector<long long> square(4 * 4, 0);
+    ariel::Strassen::multiply(4, big.data(), big.data(), square.data(), 1);
+    CHECK(square[0] == 4000000000000000000LL);
+}
+
+TEST_CASE("Test operator* on large dense graphs")
+{
+    size_t V = 512;
+    vector<vector<int>> matrix(V, vector<int>(V, 1));
+    for (size_t i = 0; i < V; ++i) {
+        matrix[i][i] = 0;
+    }
+    ariel::Graph complete;
+    complete.loadGraph(matrix);
+    ariel::Graph squared = complete * complete;
+    CHECK(squared.getWeight(0, 1) == 510);
+    CHECK(squared.getWeight(7, 7) == 0);
+    CHECK(squared.getNumEdges() == 512 * 511);
+}
+
+// --------------------- WEIGHT TYPE TESTS ---------------------
+
+TEST_CASE("Test narrow and wide weight types")
+{
+    ariel::BasicGraph<int8_t> narrow;
+    narrow.loadGraph({{0, 1, 0}, {1, 0, 1}, {0, 1, 0}});
+    CHECK(narrow.getNumEdges() == 4);
+    CHECK(ariel::Algorithms::isConnected(narrow) == true);
+    CHECK(ariel::Algorithms::isBipartite(narrow) == "The graph is bipartite: A={0, 2}, B={1}.");
+    CHECK(ariel::Algorithms::shortestPath(narrow, 0, 2) == "0->1->2");
+    CHECK(ariel::Algorithms::isContainsCycle(narrow) == "No cycle found");
+
+    // Distances are summed in 64 bits, so a path longer than any int8 fits
+    ariel::BasicGraph<int8_t> chain;
+    vector<vector<int8_t>> links(4, vector<int8_t>(4, 0));
+    links[0][1] = links[1][2] = links[2][3] = 100;
+    links[0][3] = 127;
+    chain.loadGraph(links);
+    CHECK(ariel::Algorithms::shortestPath(chain, 0, 3) == "0->3");
+
+    // int64 weights beyond int
+    ariel::BasicGraph<int64_t> wide;
+    wide.loadGraph({{0, 3000000000LL, 0}, {0, 0, 3000000000LL}, {7000000000LL, 0, 0}});
+    CHECK(wide.getMaxWeight() == 7000000000LL);
+    CHECK((wide * wide).getWeight(0, 2) == 9000000000000000000LL);
+    CHECK(ariel::Algorithms::shortestPath(wide, 0, 2) == "0->1->2");
+    CHECK(ariel::Algorithms::negativeCycle(wide) == "No negative cycle found");
+
+    // Floating point weights
+    ariel::BasicGraph<double> real;
+    real.loadGraph({{0, 0.5, 2.0}, {0.5, 0, 1.25}, {2.0, 1.25, 0}});
+    CHECK(ariel::Algorithms::shortestPath(real, 0, 2) == "0->1->2");
+    CHECK((real * real).getWeight(0, 2) == doctest::Approx(0.625));
+    real.addEdge(2, 0, -2.5);
+    CHECK(ariel::Algorithms::negativeCycle(real) == "Negative cycle found");
+    ariel::BasicGraph<float> half = ariel::BasicGraph<float>();
+    half.loadGraph({{0, 1.5f}, {1.5f, 0}});
+    half * 2.0f;
+    CHECK(half.getWeight(0, 1) == 3.0f);
+    CHECK(half.isSymmetric());
+
+    // int16 graphs keep the operators
+    ariel::BasicGraph<int16_t> a;
+    ariel::BasicGraph<int16_t> b;
+    a.loadGraph({{0, 1}, {2, 0}});
+    b.loadGraph({{0, 3}, {4, 0}});
+    CHECK((a + b).getWeight(1, 0) == 6);
+    CHECK(a != a + b);
+    CHECK((-a).hasNegativeWeights());
+}
+
+// --------------------- FIXED GRAPH TESTS ---------------------
+
+static constexpr ariel::FixedGraph<4> fixedSquare()
+{
+    return {{0, 1, 0, 1}, {1, 0, 1, 0}, {0, 1, 0, 1}, {1, 0, 1, 0}};
+}
+
+static constexpr ariel::FixedGraph<3> fixedTriangle()
+{
+    return {{0, 1, 4}, {1, 0, 2}, {4, 2, 0}};
+}
+
+// Evaluated by the compiler
+static_assert(fixedSquare().getNumEdges() == 8, "");
+static_assert(ariel::FixedAlgorithms::isConnected(fixedSquare()), "");
+static_assert(ariel::FixedAlgorithms::isBipartite(fixedSquare()), "");
+static_assert(!ariel::FixedAlgorithms::isBipartite(fixedTriangle()), "");
+static_assert(ariel::FixedAlgorithms::containsCycle(fixedTriangle()), "");
+static_assert(!ariel::FixedAlgorithms::containsCycle(ariel::FixedGraph<3>{{0, 1, 0}, {1, 0, 1}, {0, 1, 0}}), "");
+static_assert(ariel::FixedAlgorithms::shortestPath(fixedTriangle(), 0, 2).distance == 3, "");
+static_assert((fixedTriangle() * fixedTriangle()).getWeight(0, 2) == 2, "");
+static_assert(fixedSquare() - fixedSquare() == ariel::FixedGraph<4>(), "");
+
+TEST_CASE("Test fixed graph operators")
+{
+    constexpr ariel::FixedGraph<3> g = fixedTriangle();
+    CHECK((g + g).getWeight(0, 2) == 8);
+    CHECK((-g).getWeight(1, 2) == -2);
+    CHECK((g * 3).getWeight(0, 1) == 3);
+    CHECK(g * 1 == g);
+    CHECK(g + g != g);
+
+    ariel::FixedGraph<3> h;
+    h.setWeight(0, 1, 5);
+    CHECK(h.getNumEdges() == 1);
+    h.setWeight(0, 1, 0);
+    CHECK(h == ariel::FixedGraph<3>());
+    CHECK_THROWS(h.setWeight(1, 1, 2));
+    CHECK_THROWS(h.setWeight(0, 3, 2));
+    CHECK_THROWS(ariel::FixedGraph<2>({{0, 1}}));
+    CHECK_THROWS(ariel::FixedGraph<2>({{1, 1}, {1, 0}}));
+
+    // Products agree with Graph's
+    ariel::Graph dynamic;
+    dynamic.loadGraph(g.toMatrix());
+    CHECK((dynamic * dynamic).getGraph() == (g * g).toMatrix());
+}
+
+TEST_CASE("Test fixed graph algorithms match Algorithms")
+{
+    mt19937 rng(43);
+    for (int trial = 0; trial < 200; ++trial) {
+        ariel::FixedGraph<6> fixed;
+        for (size_t i = 0; i < 6; ++i) {
+            for (size_t j = 0; j < 6; ++j) {
+                if (i != j && rng() % 3 == 0) {
+                    int weight = static_cast<int>(rng() % 9) - (trial % 2 == 0 ? 0 : 2);
+                    fixed.setWeight(i, j, weight);
+                    if (trial % 4 == 0) {
+                        fixed.setWeight(j, i, weight);
+                    }
+                }
+            }
+        }
+        ariel::Graph graph;
+        graph.loadGraph(fixed.toMatrix());
+
+        CHECK(ariel::FixedAlgorithms::isConnected(fixed) == ariel::Algorithms::isConnected<int>(graph));
+        CHECK(ariel::FixedAlgorithms::isBipartite(fixed) == (ariel::Algorithms::isBipartite(graph) != "The graph isn't bipartite."));
+        CHECK(ariel::FixedAlgorithms::containsCycle(fixed) == (ariel::Algorithms::isContainsCycle(graph) != "No cycle found"));
+        CHECK(ariel::FixedAlgorithms::negativeCycle(fixed) == (ariel::Algorithms::negativeCycle(graph) == "Negative cycle found"));
+        ariel::FixedPath<6> path = ariel::FixedAlgorithms::shortestPath(fixed, 0, 5);
+        CHECK(path.toString() == ariel::Algorithms::shortestPath<int>(graph, 0, 5));
+    }
+
+    CHECK(ariel::FixedAlgorithms::shortestPath(fixedSquare(), 1, 1).toString() == "Invalid request - path to itself");
+    CHECK(ariel::FixedAlgorithms::shortestPath(fixedSquare(), 0, 4).status == ariel::PathStatus::InvalidVertex);
+}
+
+// --------------------- BITMASK GRAPH TESTS ---------------------
+
+TEST_CASE("Test bitmask engine matches the generic searches")
+{
+    mt19937 rng(44);
+    const size_t sizes[] = {1, 2, 5, 17, 63, 64};
+    for (size_t V : sizes) {
+        for (int trial = 0; trial < 20; ++trial) {
+            vector<vector<int>> matrix(V, vector<int>(V, 0));
+            unsigned sparsity = 2 + static_cast<unsigned>(trial % 4) * static_cast<unsigned>(V);
+            for (size_t i = 0; i < V; ++i) {
+                for (size_t j = 0; j < V; ++j) {
+                    if (i != j && rng() % sparsity == 0) {
+                        matrix[i][j] = 1;
+                        if (trial % 2 == 0) {
+                            matrix[j][i] = 1;
+                        }
+                    }
+                }
+            }
+            ariel::Graph g;
+            g.loadGraph(matrix);
+            CHECK(ariel::Algorithms::isConnected(g) == ariel::Algorithms::isConnected<int>(g));
+            CHECK(ariel::Algorithms::isBipartite(g) == ariel::Algorithms::isBipartite<int>(g));
+            CHECK(ariel::Algorithms::isContainsCycle(g) == ariel::Algorithms::isContainsCycle<int>(g));
+
+            // Unit weights: the bitmask BFS keeps Bellman-Ford's predecessors
+            size_t start = static_cast<size_t>(trial) * 7 % V;
+            for (size_t end = 0; end < V; end += V / 8 + 1) {
+                CHECK(ariel::Algorithms::shortestPath(g, start, end) == ariel::Algorithms::shortestPath<int>(g, start, end));
+            }
+        }
+    }
+}
+
+TEST_CASE("Test bitmask graph queries")
+{
+    ariel::Graph g;
+    g.loadGraph({{0, 1, 0, 0}, {0, 0, 1, 1}, {1, 0, 0, 0}, {0, 0, 0, 0}});
+    ariel::BitGraph bits = ariel::BitGraph::fromGraph(g);
+    CHECK(bits.getNumVertices() == 4);
+    CHECK(bits.isConnected());
+
+    size_t path[ariel::BitGraph::MAX_VERTICES];
+    CHECK(bits.findCycle(path) == 3);
+    CHECK(path[2] == 2);
+    CHECK(bits.shortestPath(2, 3, path) == 4);
+    CHECK(path[1] == 0);
+    CHECK(bits.shortestPath(3, 0, path) == 0);
+    CHECK_THROWS(bits.shortestPath(0, 4, path));
+
+    // Odd cycle
+    uint64_t sideB = 0;
+    CHECK_FALSE(bits.bipartition(path, sideB));
+
+    // Two directions of one edge are not a cycle, but a negative pair is
+    g.loadGraph({{0, 3}, {3, 0}});
+    CHECK(ariel::Algorithms::isContainsCycle(g) == "No cycle found");
+    g.loadGraph({{0, -3}, {-3, 0}});
+    CHECK(ariel::Algorithms::isContainsCycle(g) == "Negative cycle found");
+
+    ariel::Graph big;
+    big.loadGraph(vector<vector<int>>(65, vector<int>(65, 0)));
+    CHECK_THROWS(ariel::BitGraph::fromGraph(big));
+}
+
+// --------------------- GRAPH BATCH TESTS ---------------------
+
+TEST_CASE("Test graph batch queries match Algorithms")
+{
+    mt19937 rng(45);
+    const size_t sizes[] = {1, 2, 5, 9};
+    for (size_t V : sizes) {
+        ariel::GraphBatch batch(V, 150);
+        for (size_t g = 0; g < batch.getNumGraphs(); ++g) {
+            for (size_t i = 0; i < V; ++i) {
+                for (size_t j = 0; j < V; ++j) {
+                    if (i != j && rng() % 3 == 0) {
+                        int weight = static_cast<int>(rng() % 10) - (g % 3 == 0 ? 2 : 0);
+                        batch.setWeight(g, i, j, weight);
+                        if (g % 2 == 0) {
+                            batch.setWeight(g, j, i, weight);
+                        }
+                    }
+                }
+            }
+        }
+        vector<unsigned char> connected = batch.isConnected(2);
+        vector<unsigned char> bipartite = batch.isBipartite(2);
+        vector<unsigned char> negative = batch.negativeCycle(1);
+        CHECK(connected.size() == 150);
+        for (size_t g = 0; g < batch.getNumGraphs(); ++g) {
+            ariel::Graph graph = batch.getGraph(g);
+            CHECK((connected[g] == 1) == ariel::Algorithms::isConnected<int>(graph));
+            CHECK((bipartite[g] == 1) == (ariel::Algorithms::isBipartite<int>(graph) != "The graph isn't bipartite."));
+            CHECK((negative[g] == 1) == (ariel::Algorithms::negativeCycle(graph) == "Negative cycle found"));
+        }
+    }
+}
+
+TEST_CASE("Test graph batch storage")
+{
+    ariel::GraphBatch batch(3, 2);
+    ariel::Graph g;
+    g.loadGraph({{0, 1, 0}, {1, 0, 2}, {0, 2, 0}});
+    batch.setGraph(1, g);
+    CHECK(batch.getWeight(1, 2, 1) == 2);
+    CHECK(batch.getWeight(0, 2, 1) == 0);
+    CHECK(batch.getGraph(1) == g);
+    CHECK(batch.isConnected() == vector<unsigned char>{0, 1});
+    CHECK(batch.isBipartite() == vector<unsigned char>{0, 1});
+
+    ariel::Graph other;
+    other.loadGraph({{0, 1}, {1, 0}});
+    CHECK_THROWS(batch.setGraph(0, other));
+    CHECK_THROWS(batch.setGraph(2, g));
+    CHECK_THROWS(batch.setWeight(0, 1, 1, 4));
+    CHECK_THROWS(batch.getWeight(0, 3, 0));
+    CHECK_THROWS(ariel::GraphBatch(0, 5));
+}
+
+// --------------------- SYMMETRIC STORAGE TESTS ---------------------
+
+TEST_CASE("Test symmetric storage keeps half the matrix")
+{
+    ariel::Graph full;
+    full.loadGraph({{0, 1, 0, 4}, {1, 0, 2, 0}, {0, 2, 0, 3}, {4, 0, 3, 0}});
+    ariel::Graph packed = full;
+    packed.setStorage(ariel::GraphStorage::Symmetric);
+    CHECK(packed.getStorage() == ariel::GraphStorage::Symmetric);
+    CHECK(packed.storageBytes() == 6 * sizeof(int));
+    CHECK(full.storageBytes() == 16 * sizeof(int));
+    CHECK(packed == full);
+    CHECK(packed.getGraph() == full.getGraph());
+    CHECK(packed.getNumEdges() == 8);
+    CHECK(packed.isEdge(3, 0));
+    CHECK(packed.getWeight(2, 1) == 2);
+
+    // Algorithms see the same graph
+    CHECK(ariel::Algorithms::isConnected(packed));
+    CHECK(ariel::Algorithms::isBipartite(packed) == ariel::Algorithms::isBipartite(full));
+    CHECK(ariel::Algorithms::isContainsCycle(packed) == ariel::Algorithms::isContainsCycle(full));
+    CHECK(ariel::Algorithms::shortestPath(packed, 0, 2) == ariel::Algorithms::shortestPath(full, 0, 2));
+    CHECK(ariel::Algorithms::minimumSpanningTree(packed).totalWeight == 6);
+    CHECK(ariel::CSRGraph::fromGraph(packed).targets == ariel::CSRGraph::fromGraph(full).targets);
+
+    // Only symmetric graphs can be packed
+    ariel::Graph directed;
+    directed.loadGraph({{0, 1}, {0, 0}});
+    CHECK_THROWS(directed.setStorage(ariel::GraphStorage::Symmetric));
+    CHECK_THROWS(packed.loadGraph({{0, 1}, {2, 0}}));
+    packed.setStorage(ariel::GraphStorage::Full);
+    CHECK(packed == full);
+    CHECK(packed.storageBytes() == full.storageBytes());
+}
+
+TEST_CASE("Test symmetric storage operators and mutations")
+{
+    vector<vector<int>> matrix = {{0, 2, 0}, {2, 0, 5}, {0, 5, 0}};
+    ariel::Graph full;
+    full.loadGraph(matrix);
+    ariel::Graph packed;
+    packed.setStorage(ariel::GraphStorage::Symmetric);
+    packed.loadGraph(matrix);
+
+    // Results of symmetric operands stay packed
+    CHECK((packed + packed).getStorage() == ariel::GraphStorage::Symmetric);
+    CHECK((packed + packed) == full + full);
+    CHECK((packed * packed) == full * full);
+    CHECK(-packed == -full);
+    ++packed;
+    ++full;
+    CHECK(packed == full);
+    packed * 3;
+    full * 3;
+    CHECK(packed == full);
+    packed -= full;
+    CHECK(packed.getNumEdges() == 0);
+    CHECK(packed.getStorage() == ariel::GraphStorage::Symmetric);
+
+    // An edge and its reverse are one cell
+    packed.addEdge(2, 0, 7);
+    CHECK(packed.getWeight(0, 2) == 7);
+    CHECK(packed.getNumEdges() == 2);
+    CHECK(packed.getMaxWeight() == 7);
+    CHECK(packed.isSymmetric());
+    packed.removeEdge(0, 2);
+    CHECK(packed.getNumEdges() == 0);
+    CHECK(packed.getMaxWeight() == 0);
+
+    // Vertices come and go with the triangle's last column
+    packed.loadGraph(matrix);
+    size_t added = packed.addVertex();
+    packed.addEdge(added, 0, 9);
+    CHECK(packed.getWeight(0, 3) == 9);
+    packed.removeVertex(1);
+    CHECK(packed.getNumVertices() == 3);
+    CHECK(packed.getGraph() == vector<vector<int>>{{0, 9, 0}, {9, 0, 0}, {0, 0, 0}});
+    CHECK(packed.storageBytes() == 3 * sizeof(int));
+
+    // A directed operand unpacks the result
+    ariel::Graph directed;
+    directed.loadGraph({{0, 1, 0}, {0, 0, 0}, {0, 0, 0}});
+    packed += directed;
+    CHECK(packed.getStorage() == ariel::GraphStorage::Full);
+    CHECK(packed.getWeight(0, 1) == 10);
+    CHECK(packed.getWeight(1, 0) == 9);
+}
+
+// --------------------- GRAPH FILE TESTS ---------------------
+
+// Whole contents of a file
+static string readFileBytes(const string& path)
+{
+    ifstream in(path, ios::binary);
+    return string(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+}
+
+// Replace the contents of a file
+static void writeFileBytes(const string& path, const string& bytes)
+{
+    ofstream out(path, ios::binary | ios::trunc);
+    out.write(bytes.data(), static_cast<streamsize>(bytes.size()));
+}
+
+TEST_CASE("Test graph files round trip in both layouts")
+{
+    ariel::Graph g;
+    g.loadGraph({{0, 3, 0, -1}, {0, 0, 2, 0}, {5, 0, 0, 0}, {0, 3, 0, 0}});
+    ariel::GraphFileLayout layouts[] = {ariel::GraphFileLayout::Dense, ariel::GraphFileLayout::CSR};
+    for (ariel::GraphFileLayout layout : layouts) {
+        g.saveGraphFile("/tmp/ariel_test.graph", layout);
+        ariel::Graph mapped;
+        mapped.loadGraphFile("/tmp/ariel_test.graph");
+        CHECK(mapped.getStorage() == ariel::GraphStorage::Mapped);
+        CHECK(mapped.mappedFile()->layout() == layout);
+        CHECK(mapped.storageBytes() == 0);
+        CHECK(mapped == g);
+        CHECK(mapped.getGraph() == g.getGraph());
+        CHECK(mapped.getNumEdges() == 5);
+        CHECK(mapped.getMaxWeight() == 5);
+        CHECK(mapped.isEdge(3, 1));
+        CHECK_FALSE(mapped.isEdge(1, 3));
+
+        // Algorithms run straight off the file
+        CHECK(ariel::Algorithms::shortestPath(mapped, 0, 2) == ariel::Algorithms::shortestPath(g, 0, 2));
+        CHECK(ariel::Algorithms::isContainsCycle(mapped) == ariel::Algorithms::isContainsCycle(g));
+        CHECK(ariel::CSRGraph::fromGraph(mapped).targets == ariel::CSRGraph::fromGraph(g).targets);
+        CHECK(ariel::CSRGraph::fromGraph(mapped).weights == ariel::CSRGraph::fromGraph(g).weights);
+
+        // The first change copies the file into a full matrix
+        mapped.addEdge(1, 3, 7);
+        CHECK(mapped.getStorage() == ariel::GraphStorage::Full);
+        CHECK(mapped.getWeight(1, 3) == 7);
+        CHECK(mapped.getWeight(0, 3) == -1);
+        CHECK(mapped.getNumEdges() == 6);
+    }
+
+    // Auto picks CSR for a sparse graph
+    ariel::Graph sparse;
+    sparse.loadGraph(vector<vector<int>>(64, vector<int>(64, 0)));
+    sparse.addEdge(0, 63, 1);
+    sparse.saveGraphFile("/tmp/ariel_test.graph");
+    ariel::Graph mapped;
+    mapped.loadGraphFile("/tmp/ariel_test.graph");
+    CHECK(mapped.mappedFile()->layout() == ariel::GraphFileLayout::CSR);
+    CHECK(mapped == sparse);
+    mapped.removeVertex(5); // Vertex 63 takes its slot
+    CHECK(mapped.getNumVertices() == 63);
+    CHECK(mapped.getWeight(0, 5) == 1);
+}
+
+TEST_CASE("Test graph files of other weights and bad files")
+{
+    ariel::BasicGraph<double> real;
+    real.loadGraph({{0, 0.5}, {-2.25, 0}});
+    real.saveGraphFile("/tmp/ariel_test.graph");
+    ariel::BasicGraph<double> mapped;
+    mapped.loadGraphFile("/tmp/ariel_test.graph");
+    CHECK(mapped == real);
+    CHECK(mapped.getWeight(1, 0) == -2.25);
+
+    // The weight type is part of the format
+    ariel::Graph wrongType;
+    CHECK_THROWS(wrongType.loadGraphFile("/tmp/ariel_test.graph"));
+    CHECK_THROWS(wrongType.loadGraphFile("/tmp/ariel_missing.graph"));
+    CHECK_THROWS(ariel::Graph().saveGraphFile("/tmp/ariel_test.graph"));
+
+    // A truncated file or a wrong magic is rejected
+    ariel::Graph g;
+    g.loadGraph({{0, 1}, {1, 0}});
+    g.saveGraphFile("/tmp/ariel_test.graph", ariel::GraphFileLayout::Dense);
+    string bytes = readFileBytes("/tmp/ariel_test.graph");
+    writeFileBytes("/tmp/ariel_test.graph", bytes.substr(0, bytes.size() - 4));
+    CHECK_THROWS(g.loadGraphFile("/tmp/ariel_test.graph"));
+    bytes[0] = 'X';
+    writeFileBytes("/tmp/ariel_test.graph", bytes);
+    CHECK_THROWS(g.loadGraphFile("/tmp/ariel_test.graph"));
+    CHECK(g.getNumVertices() == 2); // A failed load leaves the graph alone
+    remove("/tmp/ariel_test.graph");
+}
+
+TEST_CASE("Test corrupt graph file headers and CSR rows are rejected")
+{
+    ariel::Graph g;
+    g.loadGraph({{0, 1, 2}, {3, 0, 0}, {0, 4, 0}});
+
+    // A vertex count whose V * V wraps to 0 must not pass the size check
+    g.saveGraphFile("/tmp/ariel_test.graph", ariel::GraphFileLayout::Dense);
+    string dense = readFileBytes("/tmp/ariel_test.graph");
+    uint64_t numVertices = uint64_t(1) << 32;
+    memcpy(&dense[offsetof(ariel::GraphFileHeader, numVertices)], &numVertices, sizeof(numVertices));
+    writeFileBytes("/tmp/ariel_test.graph", dense);
+    ariel::Graph mapped;
+    CHECK_THROWS(mapped.loadGraphFile("/tmp/ariel_test.graph"));
+
+    // CSR rows: offsets going backwards, a target out of range, targets out of order
+    g.saveGraphFile("/tmp/ariel_test.graph", ariel::GraphFileLayout::CSR);
+    string csr = readFileBytes("/tmp/ariel_test.graph");
+    ariel::GraphFileHeader header;
+    memcpy(&header, csr.data(), sizeof(header));
+    string badOffsets = csr;
+    uint64_t offset = 9; // Past the 4 edges
+    memcpy(&badOffsets[header.offsetsPos + sizeof(uint64_t)], &offset, sizeof(offset));
+    writeFileBytes("/tmp/ariel_test.graph", badOffsets);
+    CHECK_THROWS(mapped.loadGraphFile("/tmp/ariel_test.graph"));
+    string badTarget = csr;
+    uint32_t target = 7;
+    memcpy(&badTarget[header.targetsPos], &target, sizeof(target));
+    writeFileBytes("/tmp/ariel_test.graph", badTarget);
+    CHECK_THROWS(mapped.loadGraphFile("/tmp/ariel_test.graph"));
+    string unsorted = csr;
+    uint32_t swapped[] = {2, 1};
+    memcpy(&unsorted[header.targetsPos], swapped, sizeof(swapped));
+    writeFileBytes("/tmp/ariel_test.graph", unsorted);
+    CHECK_THROWS(mapped.loadGraphFile("/tmp/ariel_test.graph"));
+
+    // The intact file still loads
+    writeFileBytes("/tmp/ariel_test.graph", csr);
+    mapped.loadGraphFile("/tmp/ariel_test.graph");
+    CHECK(mapped == g);
+    remove("/tmp/ariel_test.graph");
+}
+
+// --------------------- GRAPH PARSER TESTS ---------------------
+
+TEST_CASE("Test parsing edge lists, DIMACS and Matrix Market")
+{
+    vector<vector<int>> expected = {{0, 4, 0}, {0, 0, -2}, {1, 0, 0}};
+    ariel::Graph g;
+    istringstream edgeList("# comment\n0 1 4\n1 2 -2\r\n\n2 0\n");
+    ariel::ParseReport report = ariel::GraphParser::read(g, edgeList, ariel::GraphTextFormat::EdgeList);
+    CHECK(g.getGraph() == expected);
+    CHECK(g.getNumEdges() == 3);
+    CHECK(g.hasNegativeWeights());
+    CHECK(report.entries == 3);
+    CHECK(report.bytes == 29);
+
+    istringstream dimacs("c test\np sp 3 3\na 1 2 4\nc middle\na 2 3 -2\na 3 1 1\n");
+    ariel::GraphParser::read(g, dimacs, ariel::GraphTextFormat::Dimacs);
+    CHECK(g.getGraph() == expected);
+
+    istringstream general("%%MatrixMarket matrix coordinate integer general\n% comment\n3 3 3\n1 2 4\n2 3 -2\n3 1 1\n");
+    ariel::GraphParser::read(g, general, ariel::GraphTextFormat::MatrixMarket);
+    CHECK(g.getGraph() == expected);
+    CHECK(g.getStorage() == ariel::GraphStorage::Full);
+
+    // A symmetric matrix lists one triangle and is built packed
+    istringstream symmetric("%%MatrixMarket matrix coordinate pattern symmetric\n3 3 2\n2 1\n3 2\n");
+    ariel::GraphParser::read(g, symmetric, ariel::GraphTextFormat::MatrixMarket);
+    CHECK(g.getStorage() == ariel::GraphStorage::Symmetric);
+    CHECK(g.getGraph() == vector<vector<int>>{{0, 1, 0}, {1, 0, 1}, {0, 1, 0}});
+    CHECK(g.getNumEdges() == 4);
+    CHECK(ariel::Algorithms::isBipartite(g) == "The graph is bipartite: A={0, 2}, B={1}.");
+
+    CHECK(ariel::GraphParser::formatOf("road.gr") == ariel::GraphTextFormat::Dimacs);
+    CHECK(ariel::GraphParser::formatOf("m.mtx") == ariel::GraphTextFormat::MatrixMarket);
+    CHECK(ariel::GraphParser::formatOf("edges.txt") == ariel::GraphTextFormat::EdgeList);
+}
+
+TEST_CASE("Test parallel parsing matches sequential parsing")
+{
+    mt19937 rng(48);
+    uniform_int_distribution<int> vertex(0, 299);
+    uniform_int_distribution<int> weight(-50, 50);
+    vector<vector<int>> matrix(300, vector<int>(300, 0));
+    ostringstream text;
+    for (int i = 0; i < 20000; ++i) {
+        int u = vertex(rng);
+        int v = vertex(rng);
+        int w = weight(rng);
+        if (u != v) {
+            matrix[static_cast<size_t>(u)][static_cast<size_t>(v)] = w; // Later lines win
+            text << u << ' ' << v << ' ' << w << '\n';
+        }
+    }
+    matrix[299][0] = matrix[299][0] == 0 ? 1 : matrix[299][0];
+    text << "299 0 " << matrix[299][0] << '\n';
+    ariel::Graph expected;
+    expected.loadGraph(matrix);
+    unsigned threadCounts[] = {1, 4};
+    for (unsigned threads : threadCounts) {
+        ariel::Graph g;
+        istringstream in(text.str());
+        ariel::GraphParser::read(g, in, ariel::GraphTextFormat::EdgeList, threads);
+        CHECK(g == expected);
+        CHECK(g.getNumEdges() == expected.getNumEdges());
+    }
+}
+
+// Stream buffer that can't seek back, like a pipe
+struct UnseekableBuffer : public stringbuf
+{
+    explicit UnseekableBuffer(const string& text) : stringbuf(text) {}
+    pos_type seekoff(off_type, ios_base::seekdir, ios_base::openmode) override { return pos_type(-1); }
+    pos_type seekpos(pos_type, ios_base::openmode) override { return pos_type(-1); }
+};
+
+TEST_CASE("Test edge lists from seekable and unseekable streams give the same graph")
+{
+    string text = "# comment\n0 1 4\n1 2 -2\n3 0 7\n1 2 5\n";
+    vector<vector<int>> expected = {{0, 4, 0, 0}, {0, 0, 5, 0}, {0, 0, 0, 0}, {7, 0, 0, 0}};
+
+    // A seekable stream is read twice but reported once
+    ariel::Graph g;
+    istringstream seekable(text);
+    ariel::ParseReport report = ariel::GraphParser::read(g, seekable, ariel::GraphTextFormat::EdgeList);
+    CHECK(g.getGraph() == expected);
+    CHECK(report.entries == 4);
+    CHECK(report.bytes == text.size());
+
+    // A pipe-like stream buffers its edges instead
+    ariel::Graph h;
+    UnseekableBuffer buffer(text);
+    istream unseekable(&buffer);
+    CHECK(unseekable.tellg() == streampos(-1));
+    report = ariel::GraphParser::read(h, unseekable, ariel::GraphTextFormat::EdgeList);
+    CHECK(h.getGraph() == expected);
+    CHECK(report.entries == 4);
+    CHECK(report.bytes == text.size());
+}
+
+TEST_CASE("Test parser errors leave the graph unchanged")
+{
+    ariel::Graph g;
+    g.loadGraph({{0, 1}, {1, 0}});
+    string bad[] = {"0 1 x\n", "0 1 99999999999\n", "-1 2\n", "0 0 5\n", ""};
+    for (const string& text : bad) {
+        istringstream in(text);
+        CHECK_THROWS(ariel::GraphParser::read(g, in, ariel::GraphTextFormat::EdgeList));
+    }
+    string badDimacs[] = {"a 1 2 3\n", "p sp 2 1\na 1 3 1\n", "p sp 2 2\na 1 2 1\n", "p sp 2 1\np sp 2 1\n", "p sp 2 1\na 1 2\n"};
+    for (const string& text : badDimacs) {
+        istringstream in(text);
+        CHECK_THROWS(ariel::GraphParser::read(g, in, ariel::GraphTextFormat::Dimacs));
+    }
+    string badMarket[] = {"3 3 0\n", "%%MatrixMarket matrix coordinate real general\n2 2 0\n",
+                               "%%MatrixMarket matrix coordinate integer general\n2 3 0\n",
+                               "%%MatrixMarket matrix coordinate integer general\n2 2 1\n1 2\n"};
+    for (const string& text : badMarket) {
+        istringstream in(text);
+        CHECK_THROWS(ariel::GraphParser::read(g, in, ariel::GraphTextFormat::MatrixMarket));
+    }
+    CHECK_THROWS(ariel::GraphParser::load(g, "/tmp/ariel_missing.txt", ariel::GraphTextFormat::EdgeList));
+    CHECK(g.getGraph() == vector<vector<int>>{{0, 1}, {1, 0}});
+}
+
+// --------------------- SNAPSHOT TESTS ---------------------
+
+TEST_CASE("Test varints and zigzag")
+{
+    vector<unsigned char> bytes;
+    uint64_t values[] = {0, 1, 127, 128, 300, 1ull << 40, ~0ull};
+    for (uint64_t value : values) {
+        ariel::appendVarint(bytes, value);
+    }
+    CHECK(bytes.size() == 1 + 1 + 1 + 2 + 2 + 6 + 10);
+    const unsigned char* p = bytes.data();
+    for (uint64_t value : values) {
+        uint64_t read = 0;
+        CHECK(ariel::readVarint(p, bytes.data() + bytes.size(), read));
+        CHECK(read == value);
+    }
+    uint64_t read = 0;
+    CHECK_FALSE(ariel::readVarint(p, bytes.data() + bytes.size(), read));
+    CHECK(ariel::zigzagEncode(-1) == 1);
+    CHECK(ariel::zigzagEncode(1) == 2);
+    CHECK(ariel::zigzagDecode(ariel::zigzagEncode(-123456789)) == -123456789);
+}
+
+TEST_CASE("Test snapshots round trip dense and sparse graphs")
+{
+    ariel::Graph dense;
+    dense.loadGraph({{0, 3, -1}, {2, 0, 4}, {5, 6, 0}});
+    stringstream denseStream;
+    dense.saveSnapshot(denseStream);
+    CHECK(denseStream.str().size() == sizeof(ariel::GraphSnapshotHeader) + 9 * sizeof(int));
+
+    vector<vector<int>> matrix(100, vector<int>(100, 0));
+    matrix[0][99] = 7;
+    matrix[50][51] = -300;
+    matrix[99][0] = 1;
+    ariel::Graph sparse;
+    sparse.loadGraph(matrix);
+    stringstream sparseStream;
+    sparse.saveSnapshot(sparseStream);
+    CHECK(sparseStream.str().size() < sizeof(ariel::GraphSnapshotHeader) + 110);
+
+    // Restore into a graph of another size, then into one of the same size
+    ariel::Graph restored;
+    restored.loadGraph({{0, 1}, {1, 0}});
+    restored.restoreSnapshot(sparseStream);
+    CHECK(restored == sparse);
+    CHECK(restored.getNumEdges() == 3);
+    CHECK(restored.hasNegativeWeights());
+    CHECK(restored.getMaxWeight() == 7);
+    CHECK_FALSE(restored.isSymmetric());
+    restored.restoreSnapshot(denseStream);
+    CHECK(restored == dense);
+    CHECK(restored.getGraph() == dense.getGraph());
+    CHECK(restored.getNumEdges() == 6);
+    CHECK(ariel::Algorithms::shortestPath(restored, 0, 1) == ariel::Algorithms::shortestPath(dense, 0, 1));
+
+    // Symmetric storage and other weight types keep their form
+    ariel::Graph packed;
+    packed.setStorage(ariel::GraphStorage::Symmetric);
+    packed.loadGraph({{0, 2, 0, 0}, {2, 0, 0, 0}, {0, 0, 0, 9}, {0, 0, 9, 0}});
+    stringstream packedStream;
+    packed.saveSnapshot(packedStream);
+    restored.restoreSnapshot(packedStream);
+    CHECK(restored.getStorage() == ariel::GraphStorage::Symmetric);
+    CHECK(restored == packed);
+    CHECK(restored.getNumEdges() == 4);
+    CHECK(restored.isSymmetric());
+
+    ariel::BasicGraph<double> real;
+    vector<vector<double>> reals(40, vector<double>(40, 0));
+    reals[3][4] = 0.25;
+    reals[39][1] = -1e10;
+    real.loadGraph(reals);
+    stringstream realStream;
+    real.saveSnapshot(realStream);
+    ariel::BasicGraph<double> realRestored;
+    realRestored.restoreSnapshot(realStream);
+    CHECK(realRestored == real);
+    CHECK(realRestored.getWeight(39, 1) == -1e10);
+}
+
+TEST_CASE("Test bad snapshots are rejected")
+{
+    ariel::Graph g;
+    g.loadGraph({{0, 1}, {1, 0}});
+    stringstream stream;
+    g.saveSnapshot(stream);
+    string bytes = stream.str();
+
+    ariel::Graph target;
+    target.loadGraph({{0, 5}, {0, 0}});
+    stringstream truncated(bytes.substr(0, bytes.size() - 1));
+    CHECK_THROWS(target.restoreSnapshot(truncated));
+    string badMagic = bytes;
+    badMagic[1] = 'x';
+    stringstream badMagicStream(badMagic);
+    CHECK_THROWS(target.restoreSnapshot(badMagicStream));
+    stringstream wrongType(bytes);
+    ariel::BasicGraph<int64_t> wide;
+    CHECK_THROWS(wide.restoreSnapshot(wrongType));
+
+    // A sparse payload whose gap runs past the row
+    vector<vector<int>> matrix(50, vector<int>(50, 0));
+    matrix[0][1] = 1;
+    ariel::Graph sparse;
+    sparse.loadGraph(matrix);
+    stringstream sparseStream;
+    sparse.saveSnapshot(sparseStream);
+    string sparseBytes = sparseStream.str();
+    sparseBytes[sizeof(ariel::GraphSnapshotHeader) + 1] = 60;
+    stringstream corrupt(sparseBytes);
+    CHECK_THROWS(target.restoreSnapshot(corrupt));
+    CHECK(target.getGraph() == vector<vector<int>>{{0, 5}, {0, 0}});
+    CHECK_THROWS(ariel::Graph().saveSnapshot(stream));
+
+    // A vertex count whose matrix size wraps around 64 bits, with an empty dense payload
+    string huge = bytes.substr(0, sizeof(ariel::GraphSnapshotHeader));
+    uint64_t numVertices = uint64_t(1) << 31;
+    uint64_t payloadBytes = 0;
+    uint32_t flags = 0;
+    memcpy(&huge[offsetof(ariel::GraphSnapshotHeader, numVertices)], &numVertices, sizeof(numVertices));
+    memcpy(&huge[offsetof(ariel::GraphSnapshotHeader, payloadBytes)], &payloadBytes, sizeof(payloadBytes));
+    memcpy(&huge[offsetof(ariel::GraphSnapshotHeader, flags)], &flags, sizeof(flags));
+    stringstream hugeStream(huge);
+    CHECK_THROWS(target.restoreSnapshot(hugeStream));
+    flags = ariel::GraphSnapshotHeader::SPARSE;
+    memcpy(&huge[offsetof(ariel::GraphSnapshotHeader, flags)], &flags, sizeof(flags));
+    stringstream hugeSparseStream(huge);
+    CHECK_THROWS(target.restoreSnapshot(hugeSparseStream));
+    CHECK(target.getGraph() == vector<vector<int>>{{0, 5}, {0, 0}});
+
+    // Only a header, claiming a dense payload of gigabytes: rejected without allocating it
+    flags = 0;
+    memcpy(&huge[offsetof(ariel::GraphSnapshotHeader, flags)], &flags, sizeof(flags));
+    uint64_t claimed[] = {20000, uint64_t(1) << 28};
+    for (uint64_t V : claimed) {
+        payloadBytes = V * V * sizeof(int);
+        memcpy(&huge[offsetof(ariel::GraphSnapshotHeader, numVertices)], &V, sizeof(V));
+        memcpy(&huge[offsetof(ariel::GraphSnapshotHeader, payloadBytes)], &payloadBytes, sizeof(payloadBytes));
+        stringstream headerOnly(huge);
+        CHECK_THROWS_AS(target.restoreSnapshot(headerOnly), invalid_argument);
+        UnseekableBuffer buffer(huge + string(1000, '\0'));
+        istream unseekable(&buffer);
+        CHECK_THROWS_AS(target.restoreSnapshot(unseekable), invalid_argument);
+    }
+    CHECK(target.getGraph() == vector<vector<int>>{{0, 5}, {0, 0}});
+}
+
+// --------------------- COMPRESSED GRAPH TESTS ---------------------
+
+// Every list of a compressed graph, read back through the iterator
+static vector<vector<size_t>> compressedLists(const ariel::CompressedGraph& graph)
+{
+    vector<vector<size_t>> lists(graph.getNumVertices());
+    ariel::CompressedGraph::NeighborIterator neighbors(graph);
+    for (size_t u = 0; u < graph.getNumVertices(); ++u) {
+        size_t degree = neighbors.reset(u);
+        size_t v = 0;
+        while (neighbors.next(v)) {
+            lists[u].push_back(v);
+        }
+        CHECK(lists[u].size() == degree);
+    }
+    return lists;
+}
+
+// Every list of an adjacency list
+static vector<vector<size_t>> csrLists(const ariel::CSRGraph& csr)
+{
+    vector<vector<size_t>> lists(csr.numVertices);
+    for (size_t u = 0; u < csr.numVertices; ++u) {
+        lists[u].assign(csr.targets.begin() + static_cast<ptrdiff_t>(csr.offsets[u]),
+                        csr.targets.begin() + static_cast<ptrdiff_t>(csr.offsets[u + 1]));
+    }
+    return lists;
+}
+
+TEST_CASE("Test compressed adjacency decodes to the original lists")
+{
+    mt19937 rng(50);
+    uniform_int_distribution<int> coin(0, 99);
+    for (int trial = 0; trial < 10; ++trial) {
+        // Rows that mostly copy the row before them, plus some noise, like a web graph
+        size_t V = 150;
+        vector<vector<int>> matrix(V, vector<int>(V, 0));
+        for (size_t u = 0; u < V; ++u) {
+            for (size_t v = 0; v < V; ++v) {
+                bool inherit = u > 0 && matrix[u - 1][v] != 0 && coin(rng) < 85;
+                if (u != v && (inherit || coin(rng) < 4)) {
+                    matrix[u][v] = 1;
+                }
+            }
+        }
+        ariel::Graph g;
+        g.loadGraph(matrix);
+        ariel::CSRGraph csr = ariel::CSRGraph::fromGraph(g);
+        ariel::CompressedGraph plain = ariel::CompressedGraph::fromGraph(g, 0);
+        ariel::CompressedGraph referenced = ariel::CompressedGraph::fromGraph(g);
+        CHECK(plain.numEdges() == csr.numEdges());
+        CHECK(referenced.numEdges() == csr.numEdges());
+        CHECK(compressedLists(plain) == csrLists(csr));
+        CHECK(compressedLists(referenced) == csrLists(csr));
+        CHECK(compressedLists(ariel::CompressedGraph::fromCSR(csr)) == csrLists(csr));
+        CHECK(referenced.storageBytes() < plain.storageBytes());
+        CHECK(referenced.bitsPerEdge() < 32);
+
+        // BFS-based algorithms give the same answers
+        CHECK(ariel::Algorithms::isConnected(referenced) == ariel::Algorithms::isConnected(g));
+        CHECK(ariel::Algorithms::isBipartite(referenced) == ariel::Algorithms::isBipartite(g));
+    }
+}
+
+TEST_CASE("Test compressed adjacency BFS queries and errors")
+{
+    ariel::Graph g;
+    g.loadGraph({{0, 1, 0, 1}, {1, 0, 1, 0}, {0, 1, 0, 1}, {1, 0, 1, 0}});
+    ariel::CompressedGraph compressed = ariel::CompressedGraph::fromGraph(g);
+    CHECK(ariel::Algorithms::isConnected(compressed));
+    CHECK(ariel::Algorithms::isBipartite(compressed) == "The graph is bipartite: A={0, 2}, B={1, 3}.");
+    g.removeEdge(3, 0);
+    g.removeEdge(0, 3);
+    g.removeEdge(1, 2);
+    g.removeEdge(2, 1);
+    CHECK_FALSE(ariel::Algorithms::isConnected(ariel::CompressedGraph::fromGraph(g)));
+
+    // Lists are appended in vertex order and must be sorted and in range
+    ariel::CompressedGraph built(3);
+    uint32_t unsorted[] = {2, 1};
+    uint32_t outOfRange[] = {3};
+    uint32_t ok[] = {1, 2};
+    CHECK_THROWS(built.appendList(unsorted, 2));
+    CHECK_THROWS(built.appendList(outOfRange, 1));
+    CHECK(built.appendList(ok, 2) == 0);
+    CHECK_FALSE(built.isComplete());
+    CHECK_THROWS(ariel::Algorithms::isConnected(built));
+    CHECK_THROWS(ariel::CompressedGraph::NeighborIterator(built).reset(1));
+    built.appendList(ok, 0);
+    built.appendList(ok, 1);
+    CHECK(built.isComplete());
+    CHECK_THROWS(built.appendList(ok, 1));
+    CHECK(ariel::Algorithms::isConnected(built));
+    CHECK(built.numEdges() == 3);
+}
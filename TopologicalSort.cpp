@@ -0,0 +1,43 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "TopologicalSort.hpp"
+
+namespace ariel {
+
+    TopologicalOrder::TopologicalOrder() : acyclic(true) {}
+
+    TopologicalOrder TopologicalOrder::fromGraph(const Graph& graph) {
+        return fromCSR(CSRGraph::fromGraph(graph));
+    }
+
+    TopologicalOrder TopologicalOrder::fromCSR(const CSRGraph& csr) {
+        const size_t V = csr.numVertices;
+        std::vector<size_t> inDegree(V, 0);
+        for (size_t target : csr.targets) {
+            inDegree[target]++;
+        }
+
+        // The result doubles as the ready queue: order[head..] is ready, order[..head) is emitted
+        TopologicalOrder result;
+        result.order.reserve(V);
+        for (size_t v = 0; v < V; ++v) {
+            if (inDegree[v] == 0) {
+                result.order.push_back(v);
+            }
+        }
+        for (size_t head = 0; head < result.order.size(); ++head) {
+            size_t u = result.order[head];
+            for (size_t e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e) {
+                if (--inDegree[csr.targets[e]] == 0) {
+                    result.order.push_back(csr.targets[e]);
+                }
+            }
+        }
+        result.acyclic = result.order.size() == V;
+        return result;
+    }
+
+} // namespace ariel
@@ -0,0 +1,32 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef TOPOLOGICALSORT_HPP
+#define TOPOLOGICALSORT_HPP
+
+#include "Graph.hpp"
+#include "CSR.hpp"
+#include <vector>
+
+namespace ariel {
+
+    // Topological order of a directed graph by Kahn's algorithm: a FIFO ready queue of vertices
+    // whose in-edges are all consumed, seeded in increasing vertex order. O(V + E) over a CSR graph.
+    struct TopologicalOrder {
+        std::vector<size_t> order; // Every edge points forward in it. With a cycle, only the vertices no cycle reaches
+        bool acyclic;              // The order covers every vertex
+
+        TopologicalOrder();
+
+        // Order the vertices of graph
+        static TopologicalOrder fromGraph(const Graph& graph);
+
+        // Same, over an adjacency list that is already built
+        static TopologicalOrder fromCSR(const CSRGraph& csr);
+    };
+
+} // namespace ariel
+
+#endif // TOPOLOGICALSORT_HPP
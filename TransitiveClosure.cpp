@@ -0,0 +1,108 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#include "TransitiveClosure.hpp"
+#include "SCC.hpp"
+#include <stdexcept>
+
+namespace ariel {
+
+    TransitiveClosure::TransitiveClosure(const Graph& graph, ClosureMethod method) : wordsPerRow(0) {
+        if (method == ClosureMethod::Warshall) {
+            buildWarshall(graph);
+        } else {
+            buildFromCondensation(graph);
+        }
+    }
+
+    void TransitiveClosure::buildFromCondensation(const Graph& graph) {
+        StrongComponents components = StrongComponents::fromGraph(graph);
+        const CSRGraph& dag = components.condensation;
+        const size_t C = components.count();
+        rowOf = components.id;
+        rowSize = components.sizes;
+        wordsPerRow = (C + 63) / 64;
+        bits.assign(C * wordsPerRow, 0);
+
+        // Components are numbered topologically, so every successor d > c is complete before c
+        for (size_t c = C; c-- > 0;) {
+            uint64_t* row = bits.data() + c * wordsPerRow;
+            row[c / 64] |= uint64_t(1) << (c % 64);
+            for (size_t e = dag.offsets[c]; e < dag.offsets[c + 1]; ++e) {
+                size_t d = dag.targets[e];
+                const uint64_t* successor = bits.data() + d * wordsPerRow;
+                // Row d has no bits below d
+                for (size_t w = d / 64; w < wordsPerRow; ++w) {
+                    row[w] |= successor[w];
+                }
+            }
+        }
+    }
+
+    void TransitiveClosure::buildWarshall(const Graph& graph) {
+        const auto V = static_cast<size_t>(graph.getNumVertices());
+        rowOf.resize(V);
+        rowSize.assign(V, 1);
+        wordsPerRow = (V + 63) / 64;
+        bits.assign(V * wordsPerRow, 0);
+        for (size_t u = 0; u < V; ++u) {
+            rowOf[u] = u;
+            uint64_t* row = bits.data() + u * wordsPerRow;
+            row[u / 64] |= uint64_t(1) << (u % 64);
+            for (size_t v = 0; v < V; ++v) {
+                if (graph.getWeight(u, v) != 0) {
+                    row[v / 64] |= uint64_t(1) << (v % 64);
+                }
+            }
+        }
+
+        for (size_t k = 0; k < V; ++k) {
+            const uint64_t* through = bits.data() + k * wordsPerRow;
+            for (size_t i = 0; i < V; ++i) {
+                uint64_t* row = bits.data() + i * wordsPerRow;
+                if (i != k && ((row[k / 64] >> (k % 64)) & 1)) {
+                    for (size_t w = 0; w < wordsPerRow; ++w) {
+                        row[w] |= through[w];
+                    }
+                }
+            }
+        }
+    }
+
+    bool TransitiveClosure::reachable(size_t u, size_t v) const {
+        if (u >= rowOf.size() || v >= rowOf.size()) {
+            throw std::invalid_argument("Invalid vertex: Vertex out of range.");
+        }
+        size_t column = rowOf[v];
+        return (bits[rowOf[u] * wordsPerRow + column / 64] >> (column % 64)) & 1;
+    }
+
+    size_t TransitiveClosure::countReachable(size_t u) const {
+        if (u >= rowOf.size()) {
+            throw std::invalid_argument("Invalid vertex: Vertex out of range.");
+        }
+        const uint64_t* row = bits.data() + rowOf[u] * wordsPerRow;
+        size_t count = 0;
+        for (size_t column = 0; column < rowSize.size(); ++column) {
+            if ((row[column / 64] >> (column % 64)) & 1) {
+                count += rowSize[column];
+            }
+        }
+        return count;
+    }
+
+    size_t TransitiveClosure::getNumVertices() const {
+        return rowOf.size();
+    }
+
+    size_t TransitiveClosure::getNumRows() const {
+        return rowSize.size();
+    }
+
+    size_t TransitiveClosure::memoryBytes() const {
+        return bits.size() * sizeof(uint64_t) + (rowOf.size() + rowSize.size()) * sizeof(size_t);
+    }
+
+} // namespace ariel
@@ -0,0 +1,54 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef TRANSITIVECLOSURE_HPP
+#define TRANSITIVECLOSURE_HPP
+
+#include "Graph.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace ariel {
+
+    // How a TransitiveClosure is built. Auto uses the condensation, which never does more word
+    // operations than Warshall and usually needs far fewer rows.
+    enum class ClosureMethod { Auto, Condensation, Warshall };
+
+    // Reachability matrix of a directed graph stored as 64-bit bitset rows, answering "can u reach v"
+    // in O(1). Every vertex reaches itself.
+    class TransitiveClosure {
+    public:
+        // Condensation: one row per strongly connected component, filled by OR-ing the rows of its
+        // successors in reverse topological order. Warshall: one row per vertex, row i |= row k
+        // whenever i reaches k, for every k in turn (O(V^3 / 64)).
+        explicit TransitiveClosure(const Graph& graph, ClosureMethod method = ClosureMethod::Auto);
+
+        // Check if there is a directed path from u to v
+        bool reachable(size_t u, size_t v) const;
+
+        // Number of vertices u reaches, itself included
+        size_t countReachable(size_t u) const;
+
+        size_t getNumVertices() const;
+
+        // Number of bitset rows (components or vertices)
+        size_t getNumRows() const;
+
+        // Bytes held by the bitsets and the vertex-to-row map
+        size_t memoryBytes() const;
+
+    private:
+        size_t wordsPerRow;
+        std::vector<size_t> rowOf;    // Row (and column) of every vertex
+        std::vector<size_t> rowSize;  // Vertices sharing every row
+        std::vector<uint64_t> bits;   // Row r is bits[r * wordsPerRow .. (r + 1) * wordsPerRow)
+
+        void buildFromCondensation(const Graph& graph);
+        void buildWarshall(const Graph& graph);
+    };
+
+} // namespace ariel
+
+#endif // TRANSITIVECLOSURE_HPP
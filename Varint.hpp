@@ -0,0 +1,49 @@
+/*
+Email: danielkuris6@gmail.com
+ID: 214539397
+Name: Daniel Kuris
+*/
+#ifndef VARINT_HPP
+#define VARINT_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace ariel {
+
+    // LEB128 variable-length integers: 7 bits per byte, the high bit set on every byte but the last,
+    // so small values (gaps between sorted neighbors, small weights) take a single byte.
+    inline void appendVarint(std::vector<unsigned char>& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<unsigned char>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<unsigned char>(value));
+    }
+
+    // Decode the varint at p and advance past it. Returns false if it runs past end or over 64 bits.
+    inline bool readVarint(const unsigned char*& p, const unsigned char* end, uint64_t& value) {
+        value = 0;
+        for (unsigned shift = 0; shift < 64 && p < end; shift += 7) {
+            unsigned char byte = *p++;
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (byte < 0x80) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Zigzag mapping of signed values to unsigned ones (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...) so
+    // small negative numbers stay short as varints
+    inline uint64_t zigzagEncode(int64_t value) {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    inline int64_t zigzagDecode(uint64_t value) {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+} // namespace ariel
+
+#endif // VARINT_HPP